@@ -0,0 +1,185 @@
+#include "CrashStackCodec.h"
+#include <string.h>
+
+void CrashStackModel::reset(uint32_t address) {
+    memset(regionRef, 0, sizeof(regionRef));
+    memset(dict, 0, sizeof(dict));
+    dictPos       = 0;
+    this->address = address;
+}
+
+int8_t CrashStackModel::lookup(uint32_t word) {
+    for (int8_t i=0; i<CRASH_STACK_DICT_SIZE; i++)
+        if (dict[i] == word) return i;
+    return -1;
+}
+
+void CrashStackModel::learn(uint32_t word, bool dictHit) {
+    regionRef[word >> 28] = word;
+    if (!dictHit) {
+        dict[dictPos] = word;
+        dictPos = (dictPos + 1) % CRASH_STACK_DICT_SIZE;
+    }
+}
+
+
+CrashStackEncoder::CrashStackEncoder(uint8_t* out, uint16_t outSize, uint32_t address) : model(address) {
+    this->out     = out;
+    this->outSize = outSize;
+    outPos        = 0;
+    runTag        = -1;
+    runOp         = 0;
+}
+
+// without out, only the length is counted
+void CrashStackEncoder::emit(uint8_t value) {
+    if (out) out[outPos] = value;
+    outPos++;
+}
+
+// start an op that can be extended by extendRun()
+void CrashStackEncoder::startRun(uint8_t op) {
+    runTag = outPos;
+    runOp = op;
+    emit(op);
+}
+
+// add one more word to the op started at runTag if possible
+bool CrashStackEncoder::extendRun(uint8_t op, uint8_t extraBytes) {
+    if (runTag < 0) return false;
+    if ((runOp & CRASH_STACK_OP_MASK) != op) return false;
+    if ((runOp & ~CRASH_STACK_OP_MASK) == CRASH_STACK_RUN_MAX - 1) return false;
+    if (outPos + extraBytes > outSize) return false;
+
+    runOp++;
+    if (out) out[runTag] = runOp;
+    return true;
+}
+
+// single word op: tag then extraBytes of extra, little endian
+bool CrashStackEncoder::put(uint8_t tag, uint8_t extraBytes, uint16_t extra) {
+    if (outPos + 1 + extraBytes > outSize) return false;
+    runTag = -1;
+    emit(tag);
+    for (uint8_t i=0; i<extraBytes; i++) emit((uint8_t)(extra >> (8*i)));
+    return true;
+}
+
+bool CrashStackEncoder::add(uint32_t word) {
+    uint32_t at = model.address;
+
+    if (word == 0) {
+        if (!extendRun(CRASH_STACK_OP_ZERO, 0)) {
+            if (outPos + 1 > outSize) return false;
+            startRun(CRASH_STACK_OP_ZERO);
+        }
+        model.address += 4;
+        return true;
+    }
+
+    int8_t idx = model.lookup(word);
+    if (idx >= 0) {
+        if (!put(CRASH_STACK_OP_DICT | idx, 0)) return false;
+        model.learn(word, true);
+        model.address += 4;
+        return true;
+    }
+
+    uint32_t ref   = model.regionRef[word >> 28];
+    int32_t  delta = (int32_t)(word - ref);
+    int32_t  slot  = (int32_t)(word - at) / 4;
+    bool     done;
+
+    if (word < 16)
+        done = put(CRASH_STACK_OP_SMALL | word, 0);
+    else if ((((word - at) & 3) == 0) && (slot >= -2048) && (slot <= 2047))
+        done = put(CRASH_STACK_OP_STACK | ((slot >> 8) & 0x0F), 1, slot & 0xFF);
+    else if ((word >= CRASH_STACK_IROM) && (word - CRASH_STACK_IROM < 0x100000))
+        done = put(CRASH_STACK_OP_IROM | ((word - CRASH_STACK_IROM) >> 16), 2, word - CRASH_STACK_IROM);
+    else if ((word >= CRASH_STACK_IRAM) && (word - CRASH_STACK_IRAM < 0x80000))
+        done = put(CRASH_STACK_OP_IRAM | ((word - CRASH_STACK_IRAM) >> 16), 2, word - CRASH_STACK_IRAM);
+    else if (word < 0x100)
+        done = put(CRASH_STACK_OP_BYTE, 1, word);
+    else if ((word >= CRASH_STACK_DRAM) && (word - CRASH_STACK_DRAM < 0x20000) && ((delta < -32768) || (delta > 32767)))
+        done = put(CRASH_STACK_OP_DRAM | ((word - CRASH_STACK_DRAM) >> 16), 2, word - CRASH_STACK_DRAM);
+    else if (ref && (delta >= -128) && (delta <= 127))
+        done = put(CRASH_STACK_OP_DELTA8 | (word >> 28), 1, (uint8_t)(int8_t) delta);
+    else if (ref && (delta >= -32768) && (delta <= 32767))
+        done = put(CRASH_STACK_OP_DELTA16 | (word >> 28), 2, (uint16_t) delta);
+    else {
+        done = extendRun(CRASH_STACK_OP_LITERAL, 4);
+        if ((!done) && (outPos + 5 <= outSize)) {
+            startRun(CRASH_STACK_OP_LITERAL);
+            done = true;
+        }
+        if (done) for (uint8_t i=0; i<4; i++) emit((uint8_t)(word >> (8*i)));
+    }
+    if (!done) return false;
+
+    model.learn(word, false);
+    model.address += 4;
+    return true;
+}
+
+
+CrashStackDecoder::CrashStackDecoder(const uint8_t* in, uint16_t inSize, uint32_t address) : model(address) {
+    this->in     = in;
+    this->inSize = inSize;
+    inPos        = 0;
+    tag          = 0;
+    remaining    = 0;
+}
+
+bool CrashStackDecoder::next(uint32_t &word) {
+    if (remaining == 0) {
+        if (inPos >= inSize) return false;
+        tag = in[inPos++];
+        remaining = ((tag & CRASH_STACK_OP_MASK) <= CRASH_STACK_OP_LITERAL) ? (tag & ~CRASH_STACK_OP_MASK) + 1 : 1;
+    }
+    remaining--;
+
+    // bytes following the tag
+    uint8_t extra = ((tag & 0xF0) == CRASH_STACK_OP_SMALL) || ((tag & 0xC0) == CRASH_STACK_OP_DICT) ? 0
+                  : ((tag & 0xF0) == CRASH_STACK_OP_DELTA8) || ((tag & 0xF0) == CRASH_STACK_OP_STACK) || (tag == CRASH_STACK_OP_BYTE) ? 1
+                  : ((tag & CRASH_STACK_OP_MASK) == CRASH_STACK_OP_ZERO) ? 0
+                  : ((tag & CRASH_STACK_OP_MASK) == CRASH_STACK_OP_LITERAL) ? 4 : 2;
+    if (inPos + extra > inSize) {
+        remaining = 0;
+        inPos     = inSize;
+        return false;
+    }
+    uint32_t value = 0;
+    for (uint8_t i=0; i<extra; i++) value |= (uint32_t)in[inPos++] << (8*i);
+
+    bool hit = false;
+    if ((tag & CRASH_STACK_OP_MASK) == CRASH_STACK_OP_ZERO) {
+        word = 0;
+        model.address += 4;
+        return true;
+    }
+    if ((tag & CRASH_STACK_OP_MASK) == CRASH_STACK_OP_LITERAL)   word = value;
+    else if ((tag & 0xC0) == CRASH_STACK_OP_DICT) {
+        word = model.dict[tag & (CRASH_STACK_DICT_SIZE - 1)];
+        hit  = true;
+    }
+    else if ((tag & 0xF0) == CRASH_STACK_OP_DELTA8)   word = model.regionRef[tag & 0x0F] + (int8_t) value;
+    else if ((tag & 0xF0) == CRASH_STACK_OP_DELTA16)  word = model.regionRef[tag & 0x0F] + (int16_t) value;
+    else if ((tag & 0xF0) == CRASH_STACK_OP_IROM)     word = CRASH_STACK_IROM + ((tag & 0x0F) << 16 | value);
+    else if ((tag & 0xF8) == CRASH_STACK_OP_IRAM)     word = CRASH_STACK_IRAM + ((tag & 0x07) << 16 | value);
+    else if (tag == CRASH_STACK_OP_BYTE)              word = value;
+    else if ((tag & 0xFE) == CRASH_STACK_OP_DRAM)     word = CRASH_STACK_DRAM + ((tag & 0x01) << 16 | value);
+    else if ((tag & 0xF0) == CRASH_STACK_OP_STACK) {
+        int32_t slot = (int32_t)(((tag & 0x0F) << 8 | value) << 20) >> 20;     // sign extended 12 bits
+        word = model.address + 4 * slot;
+    }
+    else if ((tag & 0xF0) == CRASH_STACK_OP_SMALL)    word = tag & 0x0F;
+    else {
+        // reserved op, the data is corrupted
+        remaining = 0;
+        inPos     = inSize;
+        return false;
+    }
+    model.learn(word, hit);
+    model.address += 4;
+    return true;
+}
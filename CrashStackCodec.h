@@ -0,0 +1,97 @@
+#ifndef _CRASH_STACK_CODEC_H_
+#define _CRASH_STACK_CODEC_H_
+
+#include <stdint.h>
+
+/**
+ * Compact encoding of the stack words saved by EspSaveCrash
+ *
+ * The stack is processed as 32 bit words. Each op starts with a tag byte:
+ *
+ *  000nnnnn                  n+1 zero words
+ *  001nnnnn  4*(n+1) bytes   n+1 literal words (little endian)
+ *  01iiiiii                  word = entry i of the dictionary of recent words
+ *  100xxxxx                  reserved
+ *  1010rrrr  d8              word = last word seen in region r (top nibble) + signed 8 bit delta
+ *  1011rrrr  d16             same with a signed 16 bit delta
+ *  1100cccc  c16             IROM code address, 0x40200000 + (cccc << 16 | c16)
+ *  11010ccc  c16             IRAM code address, 0x40100000 + (ccc << 16 | c16)
+ *  11011000  n8              byte value n
+ *  1101101c  c16             data RAM address, 0x3FFE0000 + (c << 16 | c16)
+ *  1110dddd  d8              pointer into the stack: address of the word itself + 4 * signed 12 bit (dddd << 8 | d8)
+ *  1111nnnn                  small value n
+ *
+ * Every non zero word that is not a dictionary hit enters the dictionary
+ * (CRASH_STACK_DICT_SIZE entries, round robin) and updates its region reference,
+ * so the decoder rebuilds the same state while reading the ops.
+ * Words are numbered from the address given to the encoder, 4 bytes apart, for the stack pointers.
+ * The model takes about 340 bytes, on the stack of the crash callback.
+ */
+#define CRASH_STACK_OP_MASK     0xE0
+#define CRASH_STACK_OP_ZERO     0x00    // 000nnnnn
+#define CRASH_STACK_OP_LITERAL  0x20    // 001nnnnn
+#define CRASH_STACK_OP_DICT     0x40    // 01iiiiii
+#define CRASH_STACK_OP_DELTA8   0xA0    // 1010rrrr
+#define CRASH_STACK_OP_DELTA16  0xB0    // 1011rrrr
+#define CRASH_STACK_OP_IROM     0xC0    // 1100cccc
+#define CRASH_STACK_OP_IRAM     0xD0    // 11010ccc
+#define CRASH_STACK_OP_BYTE     0xD8    // 11011000
+#define CRASH_STACK_OP_DRAM     0xDA    // 1101101c
+#define CRASH_STACK_OP_STACK    0xE0    // 1110dddd
+#define CRASH_STACK_OP_SMALL    0xF0    // 1111nnnn
+#define CRASH_STACK_RUN_MAX     32
+#define CRASH_STACK_DICT_SIZE   64
+#define CRASH_STACK_IROM        0x40200000
+#define CRASH_STACK_IRAM        0x40100000
+#define CRASH_STACK_DRAM        0x3FFE0000
+
+// State shared by encoder and decoder, both sides update it the same way
+class CrashStackModel {
+public:
+    uint32_t  regionRef[16];                  // last word seen per region (top nibble)
+    uint32_t  dict[CRASH_STACK_DICT_SIZE];    // recent distinct words
+    uint8_t   dictPos;
+    uint32_t  address;                        // of the next word
+
+              CrashStackModel(uint32_t address = 0) { reset(address); };
+    void      reset(uint32_t address);
+    int8_t    lookup(uint32_t word);          // dictionary index or -1
+    void      learn(uint32_t word, bool dictHit);
+};
+
+class CrashStackEncoder {
+private:
+    CrashStackModel model;
+    uint8_t*        out;
+    uint16_t        outSize;
+    uint16_t        outPos;
+    int16_t         runTag;                   // position of the tag of the op that can still be extended, -1 if none
+    uint8_t         runOp;                    // value of that tag
+
+    void            emit(uint8_t value);
+    void            startRun(uint8_t op);
+    bool            extendRun(uint8_t op, uint8_t extraBytes);
+    bool            put(uint8_t tag, uint8_t extraBytes, uint16_t extra = 0);
+
+public:
+                    // out NULL: nothing is written, length() tells the room the words need
+                    CrashStackEncoder(uint8_t* out, uint16_t outSize, uint32_t address = 0);
+    bool            add(uint32_t word);       // false when out is full, the word is then not encoded
+    uint16_t        length() { return outPos; };
+};
+
+class CrashStackDecoder {
+private:
+    CrashStackModel model;
+    const uint8_t*  in;
+    uint16_t        inSize;
+    uint16_t        inPos;
+    uint8_t         tag;
+    uint8_t         remaining;                // words left in the current op
+
+public:
+                    CrashStackDecoder(const uint8_t* in, uint16_t inSize, uint32_t address = 0);
+    bool            next(uint32_t &word);     // false once the encoded data is exhausted
+};
+
+#endif
@@ -27,6 +27,7 @@
 */
 
 #include "EspSaveCrashND.h"
+#include "LogFormat.h"
 #include <time.h>
 
 /**
@@ -39,6 +40,109 @@
 uint16_t EspSaveCrash::_offset     = 0x0010;
 uint16_t EspSaveCrash::_size       = 0x0200;
 uint32_t EspSaveCrash::_timeOffset = 0;
+bool     EspSaveCrash::_codeOnly   = false;
+
+/**
+ * Read / write the index entry of a data set
+ */
+static void readIndex(byte slot, uint16_t &sequence, uint16_t &offset, uint16_t &length)
+{
+  int16_t entry = EspSaveCrash::_offset + SAVE_CRASH_INDEX + slot * SAVE_CRASH_INDEX_SIZE;
+  EEPROM.get(entry + SAVE_CRASH_INDEX_SEQUENCE, sequence);
+  EEPROM.get(entry + SAVE_CRASH_INDEX_OFFSET, offset);
+  EEPROM.get(entry + SAVE_CRASH_INDEX_LENGTH, length);
+}
+
+static void writeIndex(byte slot, uint16_t sequence, uint16_t offset, uint16_t length)
+{
+  int16_t entry = EspSaveCrash::_offset + SAVE_CRASH_INDEX + slot * SAVE_CRASH_INDEX_SIZE;
+  EEPROM.put(entry + SAVE_CRASH_INDEX_SEQUENCE, sequence);
+  EEPROM.put(entry + SAVE_CRASH_INDEX_OFFSET, offset);
+  EEPROM.put(entry + SAVE_CRASH_INDEX_LENGTH, length);
+}
+
+/**
+ * Free all index entries, the sequence number keeps counting unless the layout is unknown
+ */
+static void resetIndex()
+{
+  if (EEPROM.read(EspSaveCrash::_offset + SAVE_CRASH_LAYOUT) != SAVE_CRASH_LAYOUT_VERSION)
+  {
+    EEPROM.write(EspSaveCrash::_offset + SAVE_CRASH_LAYOUT, SAVE_CRASH_LAYOUT_VERSION);
+    EEPROM.put(EspSaveCrash::_offset + SAVE_CRASH_NEXT_SEQUENCE, (uint16_t) 0);
+  }
+  EEPROM.put(EspSaveCrash::_offset + SAVE_CRASH_WRITE_FROM, (uint16_t) SAVE_CRASH_DATA_SETS(EspSaveCrash::_size));
+  for (byte slot = 0; slot < SAVE_CRASH_RECORDS(EspSaveCrash::_size); slot++)
+  {
+    writeIndex(slot, 0, 0, 0);
+  }
+}
+
+/**
+ * Collect the valid index entries, newest first
+ * @param order   Filled with the index slots, up to SAVE_CRASH_MAX_RECORDS entries
+ * @return Number of data sets
+ */
+static byte sortIndex(byte* order)
+{
+  if (EEPROM.read(EspSaveCrash::_offset + SAVE_CRASH_LAYOUT) != SAVE_CRASH_LAYOUT_VERSION) return 0;
+
+  uint16_t nextSequence, sequence, offset, length;
+  uint16_t age[SAVE_CRASH_MAX_RECORDS];
+  byte     count = 0;
+  EEPROM.get(EspSaveCrash::_offset + SAVE_CRASH_NEXT_SEQUENCE, nextSequence);
+
+  for (byte slot = 0; slot < SAVE_CRASH_RECORDS(EspSaveCrash::_size); slot++)
+  {
+    readIndex(slot, sequence, offset, length);
+    if ((length < SAVE_CRASH_STACK_TRACE) || (offset < SAVE_CRASH_DATA_SETS(EspSaveCrash::_size)) || (offset + length > EspSaveCrash::_size)) continue;
+
+    // insertion sort on the age, the index is only a few entries long
+    byte i = count++;
+    for (; (i > 0) && (age[i - 1] > (uint16_t)(nextSequence - sequence)); i--)
+    {
+      age[i] = age[i - 1];
+      order[i] = order[i - 1];
+    }
+    age[i] = nextSequence - sequence;
+    order[i] = slot;
+  }
+  return count;
+}
+
+/**
+ * Encode the stack words of a crash, see SAVE_CRASH_FORMAT_xxx
+ * @param out     Where to write them, NULL to get the length only
+ * @param size    Room at out
+ * @param format  SAVE_CRASH_FORMAT_TRUNCATED is added when they do not all fit
+ * @return Length of the encoded words
+ */
+static uint16_t encodeStack(uint8_t* out, uint16_t size, uint32_t stack, uint32_t stack_end, byte &format)
+{
+  uint32_t next = stack;      // code only: stack address following the previous pair
+  CrashStackEncoder encoder(out, size, (format == SAVE_CRASH_FORMAT_CODE) ? 0 : stack);
+  for (uint32_t iAddress = stack; iAddress < stack_end; iAddress += 4)
+  {
+    uint32_t word = *(uint32_t*) (uintptr_t) iAddress;
+    bool     saved;
+    if (format == SAVE_CRASH_FORMAT_CODE)
+    {
+      if (!EspSaveCrash::isCodeAddress(word)) continue;
+      saved = encoder.add((iAddress - next) >> 2) && encoder.add(word);
+      next  = iAddress + 4;
+    }
+    else
+    {
+      saved = encoder.add(word);
+    }
+    if (!saved)
+    {
+      format |= SAVE_CRASH_FORMAT_TRUNCATED;
+      break;
+    }
+  }
+  return encoder.length();
+}
 
 /**
  * Save crash information in EEPROM
@@ -51,56 +155,90 @@ extern "C" void custom_crash_callback(struct rst_info * rst_info, uint32_t stack
   // The buffer size is SAVE_CRASH_EEPROM_OFFSET + SAVE_CRASH_SPACE_SIZE
   EEPROM.begin(EspSaveCrash::_offset + EspSaveCrash::_size);
 
-  byte crashCounter = EEPROM.read(EspSaveCrash::_offset + SAVE_CRASH_COUNTER);
-  int16_t writeFrom;
-  if(crashCounter == 0)
+  // is the region big enough to hold at least one data set?
+  uint16_t dataSets = SAVE_CRASH_DATA_SETS(EspSaveCrash::_size);
+  byte     records  = SAVE_CRASH_RECORDS(EspSaveCrash::_size);
+  if (dataSets + SAVE_CRASH_STACK_TRACE >= EspSaveCrash::_size)
   {
-    writeFrom = SAVE_CRASH_DATA_SETS;
+    return;
   }
-  else
+
+  // data sets saved with another layout cannot be decoded, start over
+  if (EEPROM.read(EspSaveCrash::_offset + SAVE_CRASH_LAYOUT) != SAVE_CRASH_LAYOUT_VERSION)
   {
-    EEPROM.get(EspSaveCrash::_offset + SAVE_CRASH_WRITE_FROM, writeFrom);
+    resetIndex();
   }
 
-  // is there free EEPROM space available to save data for this crash?
-  if (writeFrom + SAVE_CRASH_STACK_TRACE > EspSaveCrash::_size)
+  uint16_t nextSequence, writeFrom;
+  EEPROM.get(EspSaveCrash::_offset + SAVE_CRASH_NEXT_SEQUENCE, nextSequence);
+  EEPROM.get(EspSaveCrash::_offset + SAVE_CRASH_WRITE_FROM, writeFrom);
+
+  // the data set does not fit in full before the end of the ring, wrap to its beginning
+  byte format = EspSaveCrash::_codeOnly ? SAVE_CRASH_FORMAT_CODE : SAVE_CRASH_FORMAT_STACK;
+  if ((writeFrom < dataSets) || (writeFrom + SAVE_CRASH_STACK_TRACE >= EspSaveCrash::_size))
   {
-    return;
+    writeFrom = dataSets;
+  }
+  else if (writeFrom > dataSets)
+  {
+    byte fits = format;
+    encodeStack(NULL, EspSaveCrash::_size - writeFrom - SAVE_CRASH_STACK_TRACE, stack, stack_end, fits);
+    if (fits & SAVE_CRASH_FORMAT_TRUNCATED) writeFrom = dataSets;
   }
 
-  // increment crash counter and write it to EEPROM
-  EEPROM.write(EspSaveCrash::_offset + SAVE_CRASH_COUNTER, ++crashCounter);
+  // take a free index entry, otherwise the oldest one
+  byte     slot = 0;
+  uint16_t oldest = 0;
+  for (byte i = 0; i < records; i++)
+  {
+    uint16_t sequence, offset, length;
+    readIndex(i, sequence, offset, length);
+    if (length == 0)
+    {
+      slot = i;
+      break;
+    }
+    if ((uint16_t)(nextSequence - sequence) >= oldest)
+    {
+      oldest = nextSequence - sequence;
+      slot = i;
+    }
+  }
 
   // now address EEPROM contents including _offset
-  writeFrom += EspSaveCrash::_offset;
+  int16_t writeAt = writeFrom + EspSaveCrash::_offset;
 
   // write crash time to EEPROM
   uint32_t crashTime = EspSaveCrash::_timeOffset + (int)(millis()/1000);
-  EEPROM.put(writeFrom + SAVE_CRASH_CRASH_TIME, crashTime);
+  EEPROM.put(writeAt + SAVE_CRASH_CRASH_TIME, crashTime);
 
   // write reset info to EEPROM
-  EEPROM.write(writeFrom + SAVE_CRASH_RESTART_REASON, rst_info->reason);
-  EEPROM.write(writeFrom + SAVE_CRASH_EXCEPTION_CAUSE, rst_info->exccause);
+  EEPROM.write(writeAt + SAVE_CRASH_RESTART_REASON, rst_info->reason);
+  EEPROM.write(writeAt + SAVE_CRASH_EXCEPTION_CAUSE, rst_info->exccause);
 
-  // write stack start and end address to EEPROM
-  EEPROM.put(writeFrom + SAVE_CRASH_STACK_START, stack);
-  EEPROM.put(writeFrom + SAVE_CRASH_STACK_END, stack_end);
+  // write stack start address and size to EEPROM
+  EEPROM.put(writeAt + SAVE_CRASH_STACK_START, stack);
+  EEPROM.put(writeAt + SAVE_CRASH_STACK_SIZE, (uint16_t)(stack_end - stack));
 
-  // write stack trace to EEPROM
-  int16_t currentAddress = writeFrom + SAVE_CRASH_STACK_TRACE;
-  for (uint32_t iAddress = stack; iAddress < stack_end; iAddress++)
+  // encode stack trace straight into the EEPROM RAM buffer, truncated only when bigger than the whole ring
+  uint16_t length = SAVE_CRASH_STACK_TRACE + encodeStack(EEPROM.getDataPtr() + writeAt + SAVE_CRASH_STACK_TRACE,
+                                                         EspSaveCrash::_size - writeFrom - SAVE_CRASH_STACK_TRACE, stack, stack_end, format);
+  EEPROM.write(writeAt + SAVE_CRASH_STACK_FORMAT, format);
+
+  // drop the older data sets overwritten by this one
+  for (byte i = 0; i < records; i++)
   {
-    byte* byteValue = (byte*) iAddress;
-    EEPROM.write(currentAddress++, *byteValue);
-    if (currentAddress - EspSaveCrash::_offset > EspSaveCrash::_size)
+    uint16_t sequence, offset, oldLength;
+    readIndex(i, sequence, offset, oldLength);
+    if ((i != slot) && oldLength && (offset < writeFrom + length) && (offset + oldLength > writeFrom))
     {
-      // ToDo: flag an incomplete stack trace written to EEPROM!
-      break;
+      writeIndex(i, 0, 0, 0);
     }
   }
-  // now exclude _offset from address written to EEPROM
-  currentAddress -= EspSaveCrash::_offset;
-  EEPROM.put(EspSaveCrash::_offset + SAVE_CRASH_WRITE_FROM, currentAddress);
+
+  writeIndex(slot, nextSequence, writeFrom, length);
+  EEPROM.put(EspSaveCrash::_offset + SAVE_CRASH_NEXT_SEQUENCE, (uint16_t)(nextSequence + 1));
+  EEPROM.put(EspSaveCrash::_offset + SAVE_CRASH_WRITE_FROM, (uint16_t)(writeFrom + length));
 
   EEPROM.commit();
 }
@@ -115,9 +253,29 @@ EspSaveCrash::EspSaveCrash(uint16_t off, uint16_t size)
   _size = size;
 }
 
+/**
+ * Give the RAM cache of the crash data sets, size() bytes, before the first print
+ * Logger::begin() carves it from the logger arena.
+ */
+void EspSaveCrash::begin(uint8_t* image)
+{
+  _image  = image;
+  _loaded = false;
+}
+
+/**
+ * Select what the next crash saves from the stack
+ * @param codeOnly  true: only the words pointing to IRAM / IROM code, with their position in the stack
+ *                  false: every stack word (default)
+ */
+void EspSaveCrash::setCodeOnly(bool codeOnly)
+{
+  _codeOnly = codeOnly;
+}
+
 /**
  * Clear crash information saved in EEPROM
- * In fact only crash counter is cleared
+ * In fact only the index is cleared
  * The crash data is not deleted
  */
 void EspSaveCrash::clear(void)
@@ -125,9 +283,52 @@ void EspSaveCrash::clear(void)
   // Note that 'EEPROM.begin' method is reserving a RAM buffer
   // The buffer size is SAVE_CRASH_EEPROM_OFFSET + SAVE_CRASH_SPACE_SIZE
   EEPROM.begin(_offset + _size);
-  // clear the crash counter
-  EEPROM.write(_offset + SAVE_CRASH_COUNTER, 0);
+  // clear the index
+  resetIndex();
   EEPROM.end();
+  _count  = 0;
+  _loaded = false;
+  _region = NULL;
+}
+
+
+/**
+ * Read the crash data sets from EEPROM into RAM, only once
+ * The region is copied as is into the image given by begin(), the records point to the encoded stack words inside it.
+ * Without an image, the EEPROM RAM buffer stays allocated and is used in place.
+ */
+void EspSaveCrash::load()
+{
+  if (_loaded) return;
+
+  // Note that 'EEPROM.begin' method is reserving a RAM buffer
+  // The buffer size is SAVE_CRASH_EEPROM_OFFSET + SAVE_CRASH_SPACE_SIZE
+  EEPROM.begin(_offset + _size);
+  if (_image) memcpy(_image, EEPROM.getConstDataPtr() + _offset, _size);
+  _region = _image ? _image : EEPROM.getConstDataPtr() + _offset;
+
+  byte order[SAVE_CRASH_MAX_RECORDS];
+  _count = sortIndex(order);
+  for (byte k = 0; k < _count; k++)
+  {
+    tCrashRecord* record = &_records[k];
+    uint16_t offset, length;
+    readIndex(order[k], record->sequence, offset, length);
+
+    int16_t  readFrom = _offset + offset;
+    uint16_t stackSize;
+    EEPROM.get(readFrom + SAVE_CRASH_CRASH_TIME, record->crashTime);
+    EEPROM.get(readFrom + SAVE_CRASH_STACK_START, record->stackStart);
+    EEPROM.get(readFrom + SAVE_CRASH_STACK_SIZE, stackSize);
+    record->stackEnd        = record->stackStart + stackSize;
+    record->reason          = EEPROM.read(readFrom + SAVE_CRASH_RESTART_REASON);
+    record->exceptionCause  = EEPROM.read(readFrom + SAVE_CRASH_EXCEPTION_CAUSE);
+    record->format          = EEPROM.read(readFrom + SAVE_CRASH_STACK_FORMAT);
+    record->stackOffset     = offset + SAVE_CRASH_STACK_TRACE;
+    record->stackLength     = length - SAVE_CRASH_STACK_TRACE;
+  }
+  if (_image) EEPROM.end();
+  _loaded = true;
 }
 
 
@@ -143,32 +344,27 @@ void EspSaveCrash::print(Print& outputDev)
   char      buf[80];
   byte      reason;  
  
-  // Note that 'EEPROM.begin' method is reserving a RAM buffer
-  // The buffer size is SAVE_CRASH_EEPROM_OFFSET + SAVE_CRASH_SPACE_SIZE
-  EEPROM.begin(_offset + _size);
-  byte crashCounter = EEPROM.read(_offset + SAVE_CRASH_COUNTER);
+  load();
   outputDev.println("- - - - - - - - - - - - - - - - - - - - - - - - - -");
-  if (crashCounter == 0)
+  if (_count == 0)
   {
     outputDev.println("No crash saved");
     outputDev.println("- - - - - - - - - - - - - - - - - - - - - - - - - -\n");
     return;
   }
 
-  outputDev.println("Crash information recovered from EEPROM");
-  int16_t readFrom = _offset + SAVE_CRASH_DATA_SETS;
-  for (byte k = 0; k < crashCounter; k++)
+  outputDev.println("Crash information recovered from EEPROM, newest first");
+  for (byte k = 0; k < _count; k++)
   {
-    uint32_t crashTime;
-    EEPROM.get(readFrom + SAVE_CRASH_CRASH_TIME, crashTime);
-    
-    rawtime = crashTime;
+    const tCrashRecord* record = &_records[k];
+
+    rawtime = record->crashTime;
     ts = *localtime(&rawtime );
     strftime(buf, sizeof(buf), "%a %Y-%m-%d %H:%M:%S", &ts);
     
-    outputDev.printf("Crash # %d at %s\n", k + 1, buf);
+    outputDev.printf("Crash # %d at %s\n", record->sequence + 1, buf);
 
-    reason = EEPROM.read(readFrom + SAVE_CRASH_RESTART_REASON);
+    reason = record->reason;
     switch (reason ) {
       case REASON_DEFAULT_RST:      strcpy(buf,"REASON_DEFAULT_RST - normal startup by power on");     break;
       case REASON_WDT_RST:          strcpy(buf,"REASON_WDT_RST - hardware watch dog reset");           break;
@@ -182,7 +378,7 @@ void EspSaveCrash::print(Print& outputDev)
     outputDev.printf("Restart reason: %d %s\n", reason ,buf);
 
     if (reason == REASON_EXCEPTION_RST) {
-      switch (EEPROM.read(readFrom + SAVE_CRASH_EXCEPTION_CAUSE)) {
+      switch (record->exceptionCause) {
         case ( 0) : strcpy(buf,"IllegalInstructionCause"); break;
         case ( 1) : strcpy(buf,"SyscallCause"); break;
         case ( 2) : strcpy(buf,"InstructionFetchErrorCause"); break;
@@ -214,49 +410,76 @@ void EspSaveCrash::print(Print& outputDev)
         case (29) : strcpy(buf,"StoreProhibitedCause"); break;
         default :   strcpy(buf,"Reserved"); break;    
       }
-      outputDev.printf("Exception cause: %d - %s\n", EEPROM.read(readFrom + SAVE_CRASH_EXCEPTION_CAUSE),buf);
+      outputDev.printf("Exception cause: %d - %s\n", record->exceptionCause, buf);
     }
 
-    uint32_t stackStart, stackEnd;
-    EEPROM.get(readFrom + SAVE_CRASH_STACK_START, stackStart);
-    EEPROM.get(readFrom + SAVE_CRASH_STACK_END, stackEnd);
+    uint32_t stackStart  = record->stackStart;
+    uint32_t stackEnd    = record->stackEnd;
+    uint16_t stackLength = record->stackLength;
+    byte     format      = record->format;
+    bool     codeOnly    = (format & ~SAVE_CRASH_FORMAT_TRUNCATED) == SAVE_CRASH_FORMAT_CODE;
     outputDev.printf(">>>stack>>>\n");
-    int16_t currentAddress = readFrom + SAVE_CRASH_STACK_TRACE;
-    int16_t stackLength = stackEnd - stackStart;
+    CrashStackDecoder decoder(stack(record), stackLength, codeOnly ? 0 : stackStart);
     uint32_t stackTrace;
-    for (int16_t i = 0; i < stackLength; i += 0x10)
+    uint32_t i = 0;
+    if (codeOnly)
     {
-      outputDev.printf("%08x: ", stackStart + i);
-      for (byte j = 0; j < 4; j++)
+      // one line per backtrace candidate, stack address first
+      uint32_t skipped, address = stackStart;
+      char     line[20];
+      while (decoder.next(skipped) && decoder.next(stackTrace))
       {
-        EEPROM.get(currentAddress, stackTrace);
-        outputDev.printf("%08x ", stackTrace);
-        currentAddress += 4;
-        if (currentAddress - _offset > _size)
+        address += skipped << 2;
+        char *p = LogHex::word(line, address);
+        address += 4;
+        *p++ = ':';
+        *p++ = ' ';
+        p = LogHex::word(p, stackTrace);
+        *p++ = '\n';
+        outputDev.write((const uint8_t*) line, p - line);
+        i++;
+      }
+    }
+    else
+    {
+      // rows of 4 words written at once, "address: word word word word"
+      char  line[8 + 2 + 4 * 9 + 1];
+      char *p = line;
+      for (i = 0; i < stackEnd - stackStart; i += 4)
+      {
+        if (!decoder.next(stackTrace)) break;
+        if ((i & 0x0F) == 0)
+        {
+          p = LogHex::word(line, stackStart + i);
+          *p++ = ':';
+          *p++ = ' ';
+        }
+        p = LogHex::word(p, stackTrace);
+        *p++ = ' ';
+        if ((i & 0x0F) == 0x0C)
         {
-          outputDev.println("\nIncomplete stack trace saved!");
-          goto eepromSpaceEnd;
+          *p++ = '\n';
+          outputDev.write((const uint8_t*) line, p - line);
         }
       }
-      outputDev.printf("\n");
+      if (i & 0x0F)
+      {
+        *p++ = '\n';
+        outputDev.write((const uint8_t*) line, p - line);
+      }
+    }
+    if (format & SAVE_CRASH_FORMAT_TRUNCATED)
+    {
+      outputDev.println("Incomplete stack trace saved!");
     }
-    eepromSpaceEnd:
     outputDev.printf("<<<stack<<<\n");
-    readFrom = readFrom + SAVE_CRASH_STACK_TRACE + stackLength;
+    if (codeOnly)
+      outputDev.printf("Stack: %d code addresses out of %d bytes saved in %d bytes\n", i, stackEnd - stackStart, stackLength);
+    else
+      outputDev.printf("Stack: %d bytes saved in %d bytes\n", i, stackLength);
   }
-  int16_t writeFrom;
-  EEPROM.get(_offset + SAVE_CRASH_WRITE_FROM, writeFrom);
-  EEPROM.end();
 
-  // is there free EEPROM space available to save data for next crash?
-  if (writeFrom + SAVE_CRASH_STACK_TRACE > _size)
-  {
-    outputDev.println("No more EEPROM space available to save crash information!");
-  }
-  else
-  {
-    outputDev.printf("EEPROM space available: 0x%04x bytes\n", _size - writeFrom);
-  }
+  outputDev.printf("%d of %d crash data sets saved, the oldest is overwritten by the next crash\n", _count, SAVE_CRASH_RECORDS(_size));
   outputDev.println("- - - - - - - - - - - - - - - - - - - - - - - - - -\n");
 }
 
@@ -293,6 +516,84 @@ size_t EspSaveCrash::print(char* userBuffer, size_t size)
   return printer._pos;
 }
 
+/**
+ * Print out crash data sets as JSON, stack words as hexadecimal strings
+ * @param outputDev Print&    Where to print: AsyncResponseStream, WiFiClient, etc.
+ */
+void EspSaveCrash::printJson(Print& outputDev)
+{
+  load();
+  outputDev.print("{\"crashes\":[");
+  for (byte k = 0; k < _count; k++)
+  {
+    const tCrashRecord* record = &_records[k];
+    bool codeOnly = (record->format & ~SAVE_CRASH_FORMAT_TRUNCATED) == SAVE_CRASH_FORMAT_CODE;
+
+    if (k) outputDev.print(",");
+    outputDev.printf("{\"sequence\":%u,\"time\":%u,\"reason\":%u,\"exccause\":%u,",
+                     record->sequence, record->crashTime, record->reason, record->exceptionCause);
+    outputDev.printf("\"stackStart\":\"%08x\",\"stackEnd\":\"%08x\",\"truncated\":%s,",
+                     record->stackStart, record->stackEnd, (record->format & SAVE_CRASH_FORMAT_TRUNCATED) ? "true" : "false");
+
+    // whole stack: list of words, code only: list of [stack address, code address]
+    outputDev.print(codeOnly ? "\"code\":[" : "\"stack\":[");
+    CrashStackDecoder decoder(stack(record), record->stackLength, codeOnly ? 0 : record->stackStart);
+    uint32_t word, skipped, address = record->stackStart;
+    char     item[32];
+    for (uint16_t i = 0; codeOnly ? decoder.next(skipped) && decoder.next(word) : decoder.next(word); i++)
+    {
+      char *p = item;
+      if (i) *p++ = ',';
+      if (codeOnly)
+      {
+        memcpy(p, "[\"", 2);
+        address += skipped << 2;
+        p = LogHex::word(p + 2, address);
+        address += 4;
+        memcpy(p, "\",\"", 3);
+        p = LogHex::word(p + 3, word);
+        memcpy(p, "\"]", 2);
+        p += 2;
+      }
+      else
+      {
+        *p++ = '"';
+        p = LogHex::word(p, word);
+        *p++ = '"';
+      }
+      outputDev.write((const uint8_t*) item, p - item);
+    }
+    outputDev.print("]}");
+  }
+  outputDev.print("]}");
+}
+
+/**
+ * Write crash data sets in the binary export format, stack words stay encoded
+ * @param outputDev Print&    Where to write: AsyncResponseStream, WiFiClient, etc.
+ */
+void EspSaveCrash::printBinary(Print& outputDev)
+{
+  load();
+  uint8_t header[SAVE_CRASH_EXPORT_HEADER] = { 'C', 'R', SAVE_CRASH_LAYOUT_VERSION, _count };
+  outputDev.write(header, sizeof(header));
+
+  for (byte k = 0; k < _count; k++)
+  {
+    const tCrashRecord* record = &_records[k];
+    // the target is little endian like the export format
+    outputDev.write((const uint8_t*) &record->sequence, 2);
+    outputDev.write((const uint8_t*) &record->crashTime, 4);
+    outputDev.write(&record->reason, 1);
+    outputDev.write(&record->exceptionCause, 1);
+    outputDev.write(&record->format, 1);
+    outputDev.write((const uint8_t*) &record->stackStart, 4);
+    outputDev.write((const uint8_t*) &record->stackEnd, 4);
+    outputDev.write((const uint8_t*) &record->stackLength, 2);
+    outputDev.write(stack(record), record->stackLength);
+  }
+}
+
 /**
  * @brief      DEPRECATED Set crash information that has been previously saved in EEPROM to user buffer
  * @param      userBuffer  The user buffer
@@ -307,10 +608,26 @@ void EspSaveCrash::crashToBuffer(char* userBuffer)
  */
 int EspSaveCrash::count()
 {
-  EEPROM.begin(_offset + _size);
-  int crashCounter = EEPROM.read(_offset + SAVE_CRASH_COUNTER);
-  EEPROM.end();
-  return crashCounter;
+  load();
+  return _count;
+}
+
+/**
+ * Get a crash data set, newest first
+ * @param k   0 for the newest crash, up to count() - 1
+ */
+const tCrashRecord* EspSaveCrash::record(byte k)
+{
+  load();
+  return (k < _count) ? &_records[k] : NULL;
+}
+
+/**
+ * Get the encoded stack words of a crash data set, decode them with CrashStackDecoder
+ */
+const uint8_t* EspSaveCrash::stack(const tCrashRecord* record)
+{
+  return _region + record->stackOffset;
 }
 
 /**
@@ -32,23 +32,43 @@
 #include "Arduino.h"
 #include "EEPROM.h"
 #include "user_interface.h"
+#include "CrashStackCodec.h"
 
 /**
  * Layout of crash data saved to EEPROM (flash)
  *
- * 1. Crash counter / how many crashes are saved
- * 2. Next available space in EEPROM to write data
- * 3. Crash Data Set 1
- * 4. Crash Data Set 2
- * 5. ...
+ * 1. Layout version, data sets written with another layout are ignored
+ * 2. Sequence number of the next crash
+ * 3. Next available space in EEPROM to write data
+ * 4. Index of crash data sets, one entry per data set (sequence number, offset, length)
+ *    a zero length entry is free, the number of entries depends on the region size
+ * 5. Ring of crash data sets, the newest crash always gets written:
+ *    it wraps to the beginning of the ring when it does not fit in full before the end
+ *    and drops the older data sets it overlaps, only a data set bigger than the ring is truncated
  */
-#define SAVE_CRASH_COUNTER          0x00  // 1 byte
-#define SAVE_CRASH_WRITE_FROM       0x01  // 2 bytes
-#define SAVE_CRASH_DATA_SETS        0x03  // beginning of crash data sets
+#define SAVE_CRASH_LAYOUT           0x00  // 1 byte
+#define SAVE_CRASH_NEXT_SEQUENCE    0x01  // 2 bytes
+#define SAVE_CRASH_WRITE_FROM       0x03  // 2 bytes
+#define SAVE_CRASH_INDEX            0x05  // SAVE_CRASH_RECORDS(size) index entries
+#define SAVE_CRASH_DATA_SETS(size)  (SAVE_CRASH_INDEX + SAVE_CRASH_RECORDS(size) * SAVE_CRASH_INDEX_SIZE)
+#define SAVE_CRASH_LAYOUT_VERSION   0x05
+#define SAVE_CRASH_MAX_RECORDS      8
+#define SAVE_CRASH_INDEX_BYTES      0x80  // one index entry per that many bytes of region, no data set is smaller
+#define SAVE_CRASH_RECORDS(size)    ((size) < 2 * SAVE_CRASH_INDEX_BYTES ? 2 : \
+                                     (size) >= SAVE_CRASH_MAX_RECORDS * SAVE_CRASH_INDEX_BYTES ? SAVE_CRASH_MAX_RECORDS : \
+                                     (size) / SAVE_CRASH_INDEX_BYTES)
 // Crash Data Set 1                       // variable length
 // Crash Data Set 2                       // variable length
 // ...                                    // variable length
 
+/**
+ * Structure of an index entry
+ */
+#define SAVE_CRASH_INDEX_SEQUENCE   0x00  // 2 bytes
+#define SAVE_CRASH_INDEX_OFFSET     0x02  // 2 bytes, from the beginning of the region
+#define SAVE_CRASH_INDEX_LENGTH     0x04  // 2 bytes, whole data set
+#define SAVE_CRASH_INDEX_SIZE       0x06
+
 /**
  * Structure of the single crash data set
  *
@@ -61,40 +81,108 @@
  *  7. excvaddr
  *  8. depc
  *  9. address of stack start
- * 10. address of stack end
- * 11. stack trace bytes
+ * 10. stack size in bytes, stack end = stack start + stack size
+ * 11. stack trace format
+ * 12. stack trace encoded words (see CrashStackCodec.h), up to the data set length
+ *     SAVE_CRASH_FORMAT_STACK : every stack word from stack start to stack end,
+ *                               encoded with the stack start as address
+ *     SAVE_CRASH_FORMAT_CODE  : pairs of (words skipped since the previous pair, word) for the
+ *                               words pointing to code only, i.e. the backtrace candidates,
+ *                               encoded with 0 as address
  *     ...
  */
 #define SAVE_CRASH_CRASH_TIME       0x00  // 4 bytes
 #define SAVE_CRASH_RESTART_REASON   0x04  // 1 byte
 #define SAVE_CRASH_EXCEPTION_CAUSE  0x05  // 1 byte
 #define SAVE_CRASH_STACK_START      0x06  // 4 bytes
-#define SAVE_CRASH_STACK_END        0x0A  // 4 bytes
-#define SAVE_CRASH_STACK_TRACE      0x0E  // variable
+#define SAVE_CRASH_STACK_SIZE       0x0A  // 2 bytes
+#define SAVE_CRASH_STACK_FORMAT     0x0C  // 1 byte
+#define SAVE_CRASH_STACK_TRACE      0x0D  // variable
+
+#define SAVE_CRASH_FORMAT_STACK     0x00
+#define SAVE_CRASH_FORMAT_CODE      0x01
+#define SAVE_CRASH_FORMAT_TRUNCATED 0x80  // the encoded words stop before stack end
+
+/**
+ * Executable address ranges, stack words inside are kept by the code only format
+ */
+#define SAVE_CRASH_IRAM_START       0x40100000
+#define SAVE_CRASH_IRAM_END         0x40108000
+#define SAVE_CRASH_IROM_START       0x40200000
+#define SAVE_CRASH_IROM_END         0x40300000
+
+/**
+ * Crash data set decoded from EEPROM, kept in RAM by EspSaveCrash
+ */
+typedef struct {
+  uint16_t  sequence;
+  uint32_t  crashTime;
+  uint32_t  stackStart;
+  uint32_t  stackEnd;
+  uint8_t   reason;
+  uint8_t   exceptionCause;
+  uint8_t   format;         // SAVE_CRASH_FORMAT_xxx
+  uint16_t  stackOffset;    // encoded stack words in the cached region
+  uint16_t  stackLength;
+} tCrashRecord;
+
+/**
+ * Binary export of the crash data sets, all fields little endian
+ *
+ * 1. 'C' 'R' SAVE_CRASH_LAYOUT_VERSION
+ * 2. Number of data sets
+ * 3. Data sets, newest first, each:
+ *    sequence (2), crash time (4), restart reason (1), exception cause (1), stack format (1),
+ *    stack start (4), stack end (4), stack length (2), encoded stack words (stack length)
+ */
+#define SAVE_CRASH_EXPORT_HEADER    4
 
 class EspSaveCrash
 {
   public:
     EspSaveCrash(uint16_t = 0x0010, uint16_t = 0x0200);
+    void begin(uint8_t* image);     // size() bytes caching the region, without it the EEPROM RAM buffer is kept as the cache
     void print(Print& outDevice = Serial);
     size_t print(char* userBuffer, size_t size);
+    void printJson(Print& outDevice);
+    void printBinary(Print& outDevice);
 
     // deprecated, for backwards-compatibility only
     void crashToBuffer(char* userBuffer);
     void setDateOffset(uint32_t timeOffset);
 
+    // save only the stack words pointing to code, several times smaller than the whole stack
+    void setCodeOnly(bool codeOnly);
+    static bool isCodeAddress(uint32_t address)
+    {
+      return ((address >= SAVE_CRASH_IRAM_START) && (address < SAVE_CRASH_IRAM_END)) ||
+             ((address >= SAVE_CRASH_IROM_START) && (address < SAVE_CRASH_IROM_END));
+    }
+
     void clear();
     int count();
     uint16_t offset();
     uint16_t size();
 
+    // data sets cached in RAM, newest first
+    const tCrashRecord* record(byte k);
+    const uint8_t* stack(const tCrashRecord* record);
+
     //These have to be public in order to be accessed by callback
     static uint16_t _offset;
     static uint16_t _size;
     static uint32_t _timeOffset;
+    static bool     _codeOnly;
     
   private:
-    // none
+    // crash data sets are read from EEPROM once, then served from RAM
+    bool            _loaded = false;
+    uint8_t*        _image  = NULL;   // copy of the region, given by begin()
+    const uint8_t*  _region = NULL;   // _image, or the EEPROM RAM buffer
+    tCrashRecord  _records[SAVE_CRASH_MAX_RECORDS];
+    byte          _count  = 0;
+
+    void load();
 };
 
 //TODO: How to gracefully report to user with new static vars?
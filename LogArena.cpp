@@ -0,0 +1,50 @@
+#include "LogArena.h"
+#include <stdlib.h>
+
+LogArena::LogArena() {
+    base    = NULL;
+    size    = 0;
+    used    = 0;
+    nbParts = 0;
+    missing = 0;
+}
+
+bool LogArena::begin(size_t size) {
+    if (base) return true;
+
+    base = (uint8_t*) malloc(size);
+    if (!base) return false;
+
+    this->size = size;
+    used       = 0;
+    return true;
+}
+
+void* LogArena::alloc(size_t size, const char* name) {
+    size_t aligned = footprint(size);
+    bool   fits    = (base) && (used + aligned <= this->size);
+
+    if (nbParts < LOG_ARENA_MAX_PARTS) {
+        parts[nbParts].name    = name;
+        parts[nbParts].size    = aligned;
+        parts[nbParts].missing = !fits;
+        nbParts++;
+    }
+    if (!fits) {
+        missing += aligned;
+        return NULL;
+    }
+
+    void* ptr = base + used;
+    used += aligned;
+    return ptr;
+}
+
+void LogArena::printReport(Print& out) {
+    out.printf("Logger memory budget: %u bytes\n", (unsigned) size);
+    for (uint8_t i=0; i<nbParts; i++)
+        out.printf("  %-16s %6u bytes%s\n", parts[i].name, (unsigned) parts[i].size, parts[i].missing ? " NOT ALLOCATED" : "");
+    out.printf("  %-16s %6u bytes\n", "(free)", (unsigned) (size - used));
+    if (missing)
+        out.printf("  %-16s %6u bytes missing, budget too small: the parts above are not there\n", "(over budget)", (unsigned) missing);
+}
@@ -0,0 +1,50 @@
+#ifndef LOG_ARENA_H
+#define LOG_ARENA_H
+
+#include <Arduino.h>
+#include <new>
+#include <utility>
+
+#define LOG_ARENA_MAX_PARTS   12
+#define LOG_ARENA_ALIGN       4
+
+/**
+ * Single allocation carved into the logger buffers and objects
+ * Parts are never freed, the arena lives as long as the logger: no heap fragmentation over time
+ * A part that does not fit in the budget is not allocated: alloc() returns NULL, printReport() lists it
+ */
+class LogArena {
+private:
+    uint8_t*    base;
+    size_t      size;
+    size_t      used;
+
+    struct {
+        const char* name;
+        size_t      size;
+        bool        missing;        // did not fit
+    }           parts[LOG_ARENA_MAX_PARTS];
+    uint8_t     nbParts;
+    size_t      missing;            // bytes of the parts not allocated, beyond the budget
+
+public:
+                LogArena();
+    bool        begin(size_t size); // the one malloc, false if the heap cannot provide it
+    void*       alloc(size_t size, const char* name);    // NULL when the budget is exhausted
+    static size_t footprint(size_t size) { return (size + LOG_ARENA_ALIGN - 1) & ~(LOG_ARENA_ALIGN - 1); };
+
+    // construct an object inside the arena
+    template<typename T, typename... Args>
+    T*          create(const char* name, Args&&... args) {
+        void* ptr = alloc(sizeof(T), name);
+        return ptr ? new (ptr) T(std::forward<Args>(args)...) : NULL;
+    };
+    size_t      available()  { return size - used; };
+    size_t      getSize()    { return size; };
+    size_t      getUsed()    { return used; };
+    size_t      getMissing() { return missing; };
+    bool        isReady()    { return base != NULL; };
+    void        printReport(Print& out);
+};
+
+#endif
@@ -0,0 +1,187 @@
+#include "LogBinary.h"
+
+LogBinary::LogBinary() {
+    sink    = NULL;
+    defined = 0;
+    len     = 0;
+    over    = false;
+    memset(formats, 0, sizeof(formats));
+}
+
+void LogBinary::begin(LogSerial* sink) {
+    this->sink = sink;
+    memset(formats, 0, sizeof(formats));
+}
+
+void LogBinary::handle(uint32_t now) {
+    if (now - defined < LOG_BINARY_REDEFINE) return;
+    defined = now;
+    memset(formats, 0, sizeof(formats));
+}
+
+void LogBinary::header(uint8_t type, uint16_t seq, uint8_t pri) {
+    uint32_t ms = millis();
+
+    len  = 0;
+    over = false;
+    put(&type, 1);
+    put(&seq, 2);
+    put(&pri, 1);
+    put(&ms, 4);
+}
+
+void LogBinary::put(const void* data, size_t size) {
+    if (len + size > LOG_BINARY_FRAME) {
+        over = true;
+        size = LOG_BINARY_FRAME - len;
+    }
+    memcpy(frame + len, data, size);
+    len += size;
+}
+
+void LogBinary::putStr(const char* s) {
+    put(s, strlen(s) + 1);
+}
+
+/* Arguments copied as the format string tells, without formatting them */
+bool LogBinary::pack(const char* fmt, va_list argp) {
+    for (const char* p = fmt; *p; p++) {
+        if (*p != '%') continue;
+        if (*++p == '%') continue;
+
+        while ((*p) && strchr("-+ #0", *p)) p++;
+        while (((*p >= '0') && (*p <= '9')) || (*p == '.')) p++;
+
+        uint8_t longs = 0;
+        while ((*p == 'l') || (*p == 'h') || (*p == 'z') || (*p == 't') || (*p == 'j')) {
+            if (*p == 'l') longs++;
+            if (*p == 'j') longs = 2;
+            p++;
+        }
+
+        switch (*p) {
+            case 'd': case 'i': case 'u': case 'x': case 'X': case 'o': case 'c':
+                if (longs >= 2) {
+                    long long v = va_arg(argp, long long);
+                    put(&v, 8);
+                } else {
+                    int32_t v = longs ? (int32_t) va_arg(argp, long) : (int32_t) va_arg(argp, int);
+                    put(&v, 4);
+                }
+                break;
+            case 'p': {
+                uint32_t v = (uint32_t) (uintptr_t) va_arg(argp, void*);
+                put(&v, 4);
+                break;
+            }
+            case 's': {
+                const char* s = va_arg(argp, const char*);
+                putStr(s ? s : "(null)");
+                break;
+            }
+            case 'f': case 'F': case 'e': case 'E': case 'g': case 'G': case 'a': case 'A': {
+                double v = va_arg(argp, double);
+                put(&v, 8);
+                break;
+            }
+            default:            // '*', %n, unknown conversion or end of string
+                return false;
+        }
+    }
+    return !over;
+}
+
+bool LogBinary::printf(uint16_t seq, uint8_t pri, const char* fmt, va_list argp) {
+    if (!sink) return false;
+
+    uint8_t id = ((uintptr_t) fmt >> 2) % LOG_BINARY_FORMATS;
+
+    // the decoder gets the format string before its first use
+    if (formats[id] != fmt) {
+        uint8_t type = LOG_BINARY_FORMAT;
+        len  = 0;
+        over = false;
+        put(&type, 1);
+        put(&id, 1);
+        putStr(fmt);
+        if ((over) || (!send())) return false;
+        formats[id] = fmt;
+    }
+
+    header(LOG_BINARY_PACKED, seq, pri);
+    put(&id, 1);
+    if (!pack(fmt, argp)) return false;
+    send();
+    return true;
+}
+
+void LogBinary::text(uint16_t seq, uint8_t pri, const char* msg, size_t size) {
+    if (!sink) return;
+
+    // what does not fit in a frame follows in the next ones, the rest is not sent once a frame is dropped
+    do {
+        size_t n = std::min(size, (size_t) (LOG_BINARY_FRAME - LOG_BINARY_HEADER));
+        header(LOG_BINARY_TEXT, seq, (n < size) ? pri | LOG_BINARY_CONTINUED : pri);
+        put(msg, n);
+        msg  += n;
+        size -= n;
+    } while ((send()) && (size));
+}
+
+void LogBinary::event(uint16_t seq, uint8_t pri, const LogEvent& event) {
+    if (!sink) return;
+
+    header(LOG_BINARY_EVENT, seq, pri);
+    putStr(event.name);
+
+    for (uint8_t pos = 0; pos < event.len; ) {
+        uint8_t     type = event.data[pos++];
+        const char* key;
+        memcpy(&key, event.data + pos, sizeof(key));
+        pos += sizeof(key);
+
+        uint8_t size = (type == LOG_KV_BOOL) ? 1 : (type == LOG_KV_STR) ? 1 + event.data[pos] : 4;
+        size_t  mark = len;
+        put(&type, 1);
+        putStr(key);
+        put(event.data + pos, size);
+        pos += size;
+
+        if (over) {             // fields that do not fit are left out
+            len  = mark;
+            over = false;
+            break;
+        }
+    }
+    send();
+}
+
+/* False when the Serial ring dropped the frame */
+bool LogBinary::send() {
+    uint8_t encoded[LOG_BINARY_FRAME + LOG_BINARY_FRAME / 254 + 2];
+    size_t  n = cobs(frame, len, encoded);
+
+    return sink->write(NULL, 0, (const char*) encoded, n);
+}
+
+/* Consistent Overhead Byte Stuffing, the frame has no 0x00 but the terminating one */
+size_t LogBinary::cobs(const uint8_t* in, size_t len, uint8_t* out) {
+    size_t  code = 0;
+    size_t  o    = 1;
+    uint8_t n    = 1;
+
+    for (size_t i=0; i<len; i++) {
+        if (in[i]) {
+            out[o++] = in[i];
+            n++;
+        }
+        if ((!in[i]) || (n == 0xFF)) {
+            out[code] = n;
+            code      = o++;
+            n         = 1;
+        }
+    }
+    out[code] = n;
+    out[o++]  = 0;
+    return o;
+}
@@ -0,0 +1,68 @@
+#ifndef LOG_BINARY_H
+#define LOG_BINARY_H
+
+#include <Arduino.h>
+#include <stdarg.h>
+#include "LogSerial.h"
+#include "LogEvent.h"
+
+#define LOG_BINARY_FRAME      128     // record before COBS encoding
+#define LOG_BINARY_HEADER     8       // type, sequence, priority, millis
+#define LOG_BINARY_FORMATS    64      // format strings known by the decoder, direct mapped
+#define LOG_BINARY_REDEFINE   10000   // ms, format strings sent again so that a late decoder catches up
+
+/**
+ * Binary Serial records, each one COBS encoded and terminated by a 0x00 byte
+ * Fields are little endian, see tools/logdecode.py
+ *
+ *   LOG_BINARY_FORMAT  type, format id (1), format string
+ *   LOG_BINARY_TEXT    type, sequence (2), priority (1), millis (4), text
+ *                      a longer text goes in several frames of the same header, priority
+ *                      flagged LOG_BINARY_CONTINUED in all but the last one
+ *   LOG_BINARY_PACKED  type, sequence (2), priority (1), millis (4), format id (1), arguments
+ *                      int / long / char / pointer: 4 bytes, long long: 8 bytes, double: 8 bytes,
+ *                      string: '\0' terminated
+ *   LOG_BINARY_EVENT   type, sequence (2), priority (1), millis (4), name '\0', fields
+ *                      field: kv type (LOG_KV_xxx), key '\0', value
+ *                      int / uint / float: 4 bytes, bool: 1 byte, string: length (1) and bytes
+ *
+ * A format string is sent once, before the first record using it, then only its id.
+ * It only counts as sent once the Serial ring took its frame, dropped records show as sequence gaps.
+ */
+#define LOG_BINARY_FORMAT     1
+#define LOG_BINARY_TEXT       2
+#define LOG_BINARY_PACKED     3
+#define LOG_BINARY_EVENT      4
+
+#define LOG_BINARY_CONTINUED  0x80    // priority flag, the text goes on in the next frame
+
+class LogBinary {
+private:
+    LogSerial*  sink;
+    const char* formats[LOG_BINARY_FORMATS];
+    uint32_t    defined;        // millis() of the last clear of formats
+
+    uint8_t     frame[LOG_BINARY_FRAME];
+    size_t      len;
+    bool        over;           // the record did not fit in the frame
+
+    void        header(uint8_t type, uint16_t seq, uint8_t pri);
+    void        put(const void* data, size_t size);
+    void        putStr(const char* s);
+    bool        pack(const char* fmt, va_list argp);
+    bool        send();
+
+public:
+                LogBinary();
+    void        begin(LogSerial* sink);
+    void        handle(uint32_t now);
+
+    // false when the format cannot be packed (e.g. "%*d", or too long), the message is then sent as text
+    bool        printf(uint16_t seq, uint8_t pri, const char* fmt, va_list argp);
+    void        text(uint16_t seq, uint8_t pri, const char* msg, size_t size);    // in several frames when longer than one
+    void        event(uint16_t seq, uint8_t pri, const LogEvent& event);
+
+    static size_t cobs(const uint8_t* in, size_t len, uint8_t* out);   // out: len + len/254 + 2 bytes
+};
+
+#endif
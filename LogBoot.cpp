@@ -0,0 +1,61 @@
+#include "LogBoot.h"
+
+LogBoot::LogBoot() {
+    used    = 0;
+    dropped = 0;
+    reached = 0;
+    mark(LOG_BOOT_CTOR);
+}
+
+void LogBoot::mark(uint8_t phase) {
+    if (isReached(phase)) return;
+    times[phase] = micros();
+    reached     |= 1 << phase;
+}
+
+void LogBoot::add(uint32_t seq, uint32_t ms, uint8_t pri, const char* msg, size_t len) {
+    if (used + sizeof(tHistoryRecord) + len > LOG_BOOT_SIZE) {
+        dropped++;
+        return;
+    }
+
+    tHistoryRecord record = { seq, ms, (uint16_t) len, pri };
+    memcpy(data + used, &record, sizeof(record));
+    memcpy(data + used + sizeof(record), msg, len);
+    used += sizeof(record) + len;
+}
+
+void LogBoot::forEach(HistoryHandler handler) {
+    for (uint16_t pos = 0; pos < used; ) {
+        tHistoryRecord record;
+        memcpy(&record, data + pos, sizeof(record));
+        if (!handler(record, (const char*) data + pos + sizeof(record))) return;
+        pos += sizeof(record) + record.len;
+    }
+}
+
+void LogBoot::printPhase(Print& out, const char* name, uint8_t phase, uint8_t from) {
+    if (!isReached(phase)) {
+        out.printf("  %-16s not reached\n", name);
+        return;
+    }
+    uint32_t at = times[phase] - times[LOG_BOOT_CTOR];
+    out.printf("  %-16s %6u.%03u ms", name, (unsigned) (at / 1000), (unsigned) (at % 1000));
+    if ((from != phase) && (isReached(from))) {
+        uint32_t took = times[phase] - times[from];
+        out.printf(", took %u.%03u ms", (unsigned) (took / 1000), (unsigned) (took % 1000));
+    }
+    out.print("\n");
+}
+
+/* Times from the Logger constructor, which runs during static initialisation */
+void LogBoot::printReport(Print& out) {
+    out.printf("Boot: constructed at %u.%03u ms\n", (unsigned) (times[LOG_BOOT_CTOR] / 1000), (unsigned) (times[LOG_BOOT_CTOR] % 1000));
+    printPhase(out, "begin()",    LOG_BOOT_BEGIN,   LOG_BOOT_BEGIN);
+    printPhase(out, "ready",      LOG_BOOT_READY,   LOG_BOOT_BEGIN);
+    printPhase(out, "first loop", LOG_BOOT_LOOP,    LOG_BOOT_LOOP);
+    printPhase(out, "network",    LOG_BOOT_NETWORK, LOG_BOOT_NETWORK);
+    printPhase(out, "sinks online", LOG_BOOT_ONLINE, LOG_BOOT_NETWORK);
+    printPhase(out, "clock set",  LOG_BOOT_CLOCK,   LOG_BOOT_NETWORK);
+    if (dropped) out.printf("  %u early messages dropped, boot buffer full\n", (unsigned) dropped);
+}
@@ -0,0 +1,46 @@
+#ifndef LOG_BOOT_H
+#define LOG_BOOT_H
+
+#include <Arduino.h>
+#include "LogHistory.h"
+
+#define LOG_BOOT_SIZE     512     // early boot buffer, bytes
+
+// boot phases, timed by mark()
+#define LOG_BOOT_CTOR     0       // Logger constructed, static initialisation
+#define LOG_BOOT_BEGIN    1       // begin() called
+#define LOG_BOOT_READY    2       // begin() returned, Serial and the history are up
+#define LOG_BOOT_LOOP     3       // first handle(), the application loop runs
+#define LOG_BOOT_NETWORK  4       // WiFi seen connected
+#define LOG_BOOT_ONLINE   5       // network sinks created
+#define LOG_BOOT_CLOCK    6       // first NTP answer
+#define LOG_BOOT_PHASES   7
+
+/**
+ * Messages logged before their sinks exist, and the time each boot phase was reached
+ * The buffer is part of the Logger object, static storage: nothing is allocated before begin().
+ * Records are kept in order until it is full, the next ones are only counted.
+ */
+class LogBoot {
+private:
+    uint8_t     data[LOG_BOOT_SIZE];
+    uint16_t    used;
+    uint16_t    dropped;
+    uint32_t    times[LOG_BOOT_PHASES];    // micros()
+    uint8_t     reached;                    // bit per phase
+
+    void        printPhase(Print& out, const char* name, uint8_t phase, uint8_t from);
+
+public:
+                LogBoot();
+    void        mark(uint8_t phase);        // the first time only
+    bool        isReached(uint8_t phase)    { return reached & (1 << phase); };
+
+    void        add(uint32_t seq, uint32_t ms, uint8_t pri, const char* msg, size_t len);
+    void        forEach(HistoryHandler handler);
+    void        clear()                     { used = 0; };
+    bool        isEmpty()                   { return used == 0; };
+    void        printReport(Print& out);
+};
+
+#endif
@@ -0,0 +1,71 @@
+#include "LogClock.h"
+#include <time.h>
+
+LogClock::LogClock() {
+    epochOffset = 0;
+    msOffset    = 0;
+    secondStart = 0;
+    cached      = false;
+    prefix[0]   = '\0';
+}
+
+void LogClock::setEpochOffset(uint32_t epochOffset) {
+    this->epochOffset = epochOffset;
+    msOffset = 0;
+    cached   = false;
+}
+
+/* Records keep their millis(), they are rendered with the offset of the time */
+int32_t LogClock::setTime(uint32_t epoch, uint32_t milli, uint32_t ms) {
+    int64_t before = (int64_t) epochOffset * 1000 + msOffset;
+    int64_t after  = (int64_t) epoch * 1000 + milli - ms;
+
+    epochOffset = after / 1000;
+    msOffset    = after % 1000;
+    cached      = false;
+    return constrain(after - before, (int64_t) INT32_MIN, (int64_t) INT32_MAX);
+}
+
+const char* LogClock::getPrefix(uint32_t ms) {
+    uint32_t t     = ms + msOffset;
+    uint32_t milli = t - secondStart;
+
+    if ((!cached) || (milli >= 1000)) {
+        time_t    rawtime = epochOffset + t / 1000;
+        struct tm ts;
+
+        localtime_r(&rawtime, &ts);
+        strftime(prefix, sizeof(prefix), "%H:%M:%S.000 - ", &ts);
+        secondStart = t - t % 1000;
+        milli       = t % 1000;
+        cached      = true;
+    }
+
+    prefix[9]  = '0' + milli / 100;
+    prefix[10] = '0' + (milli / 10) % 10;
+    prefix[11] = '0' + milli % 10;
+    return prefix;
+}
+
+/* The last time of day up to now, 0 when it was before the boot */
+bool LogClock::parseTime(const char* text, uint32_t& ms) {
+    unsigned hour, minute, second = 0;
+    if ((sscanf(text, "%u:%u:%u", &hour, &minute, &second) < 2) || (hour > 23) || (minute > 59) || (second > 59)) return false;
+
+    uint32_t  now  = millis();
+    time_t    wall = epochOffset + (now + msOffset) / 1000;
+    struct tm ts;
+
+    localtime_r(&wall, &ts);
+    ts.tm_hour = hour;
+    ts.tm_min  = minute;
+    ts.tm_sec  = second;
+    time_t at  = mktime(&ts);
+    if (at > wall) at -= 24 * 3600;
+
+    int64_t since = ((int64_t) at - epochOffset) * 1000 - msOffset;
+    ms = (since > 0) ? since : 0;
+    return true;
+}
+
+LogClock LogTime;
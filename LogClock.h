@@ -0,0 +1,32 @@
+#ifndef LOG_CLOCK_H
+#define LOG_CLOCK_H
+
+#include <Arduino.h>
+
+#define LOG_PREFIX_SIZE   16      // "HH:MM:SS.mmm - "
+
+/**
+ * Time stamp prefix shared by all sinks
+ * The text is formatted once per second, only the milliseconds are patched in for each message
+ */
+class LogClock {
+private:
+    uint32_t    epochOffset;            // wall clock seconds when millis() was 0
+    uint16_t    msOffset;               // and milliseconds
+    uint32_t    secondStart;            // millis() + msOffset at the start of the cached second
+    bool        cached;
+    char        prefix[LOG_PREFIX_SIZE];
+
+public:
+                LogClock();
+    void        setEpochOffset(uint32_t epochOffset);
+    int32_t     setTime(uint32_t epoch, uint32_t milli, uint32_t ms);  // wall clock at millis() ms, returns the step in ms
+    uint32_t    getEpochOffset() { return epochOffset; };
+    const char* getPrefix(uint32_t ms); // prefix for the millis() value ms
+    const char* getPrefix() { return getPrefix(millis()); };
+    bool        parseTime(const char* text, uint32_t& ms);  // millis() at the last "hh:mm[:ss]" wall clock time
+};
+
+extern LogClock LogTime;
+
+#endif
@@ -0,0 +1,110 @@
+#include "LogCompress.h"
+
+#define LZ_MAX_LITERAL  32
+#define LZ_MAX_MATCH    (255 + 9)
+
+static inline uint16_t lzHash(const uint8_t* p) {
+    uint32_t v = (p[0] << 16) | (p[1] << 8) | p[2];
+    return ((v * 2654435761u) >> (32 - LOG_COMPRESS_HLOG)) & ((1 << LOG_COMPRESS_HLOG) - 1);
+}
+
+size_t LogCompress::compress(const uint8_t* in, size_t len, uint8_t* out, size_t outSize, void* hash) {
+    uint16_t* table = (uint16_t*) hash;
+    size_t    ip    = 0;
+    size_t    op    = 1;            // room for the first literal run length
+    size_t    lit   = 0;            // literals in the current run
+
+    if (outSize >= len) outSize = len - 1;      // not worth it unless smaller
+    if ((len < 4) || (outSize < 2)) return 0;
+    memset(table, 0xFF, LOG_COMPRESS_HASH);
+
+    while (ip + 2 < len) {
+        uint16_t h   = lzHash(in + ip);
+        size_t   ref = table[h];
+        table[h]     = ip;
+
+        if ((ref != 0xFFFF) && (ref < ip) && (ip - ref <= LOG_COMPRESS_WINDOW) &&
+            (in[ref] == in[ip]) && (in[ref + 1] == in[ip + 1]) && (in[ref + 2] == in[ip + 2])) {
+
+            size_t n = 3;
+            while ((ip + n < len) && (n < LZ_MAX_MATCH) && (in[ref + n] == in[ip + n])) n++;
+
+            // close the literal run, or take back its unused length byte
+            if (lit) out[op - lit - 1] = lit - 1;
+            else     op--;
+            if (op + 3 > outSize) return 0;
+
+            size_t off = ip - ref - 1;
+            if (n - 2 < 7) {
+                out[op++] = ((n - 2) << 5) | (off >> 8);
+            } else {
+                out[op++] = (7 << 5) | (off >> 8);
+                out[op++] = n - 9;
+            }
+            out[op++] = off;
+
+            // keep the positions inside the match for the next ones
+            for (size_t i = ip + 1; (i < ip + n) && (i + 2 < len); i++) table[lzHash(in + i)] = i;
+            ip += n;
+
+            lit = 0;
+            op++;                       // length byte of the next literal run
+            if (op > outSize) return 0;
+            continue;
+        }
+
+        if (op + 1 > outSize) return 0;
+        out[op++] = in[ip++];
+        if (++lit == LZ_MAX_LITERAL) {
+            out[op - lit - 1] = lit - 1;
+            lit = 0;
+            op++;
+        }
+    }
+
+    while (ip < len) {
+        if (op + 1 > outSize) return 0;
+        out[op++] = in[ip++];
+        if (++lit == LZ_MAX_LITERAL) {
+            out[op - lit - 1] = lit - 1;
+            lit = 0;
+            op++;
+        }
+    }
+
+    if (lit) out[op - lit - 1] = lit - 1;
+    else     op--;
+    return op;
+}
+
+size_t LogCompress::decompress(const uint8_t* in, size_t len, uint8_t* out, size_t outSize) {
+    size_t ip = 0;
+    size_t op = 0;
+
+    while (ip < len) {
+        uint8_t ctrl = in[ip++];
+
+        if (ctrl < (1 << 5)) {
+            size_t n = ctrl + 1;
+            if ((ip + n > len) || (op + n > outSize)) return 0;
+            memcpy(out + op, in + ip, n);
+            ip += n;
+            op += n;
+            continue;
+        }
+
+        size_t n = ctrl >> 5;
+        if (n == 7) {
+            if (ip >= len) return 0;
+            n += in[ip++];
+        }
+        n += 2;
+        if (ip >= len) return 0;
+        size_t off = (((ctrl & 0x1F) << 8) | in[ip++]) + 1;
+        if ((off > op) || (op + n > outSize)) return 0;
+
+        // byte by byte, the match may overlap what it produces
+        for (size_t i = 0; i < n; i++, op++) out[op] = out[op - off];
+    }
+    return op;
+}
@@ -0,0 +1,25 @@
+#ifndef LOG_COMPRESS_H
+#define LOG_COMPRESS_H
+
+#include <Arduino.h>
+
+#define LOG_COMPRESS_HLOG     7                               // hash table of 2^HLOG positions
+#define LOG_COMPRESS_HASH     ((1 << LOG_COMPRESS_HLOG) * sizeof(uint16_t))
+#define LOG_COMPRESS_WINDOW   8192                            // farthest match
+
+/**
+ * Small LZ77 compressor for blocks of log text, byte oriented, LZF-like stream:
+ *   000lllll                        literal run of l+1 bytes
+ *   lllooooo oooooooo               match of l+2 bytes (l = 1..6), o+1 bytes back
+ *   111ooooo llllllll oooooooo      match of l+9 bytes
+ * Memory: the caller provides the hash table (LOG_COMPRESS_HASH bytes), decompression needs none
+ */
+class LogCompress {
+public:
+    // compressed length, 0 when the result would not be smaller than the input
+    static size_t compress(const uint8_t* in, size_t len, uint8_t* out, size_t outSize, void* hash);
+    // decompressed length, 0 on a corrupted stream
+    static size_t decompress(const uint8_t* in, size_t len, uint8_t* out, size_t outSize);
+};
+
+#endif
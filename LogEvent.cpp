@@ -0,0 +1,128 @@
+#include "LogEvent.h"
+#include "LogFormat.h"
+
+LogEvent::LogEvent(Logger* logger, uint8_t pri, const char* name) {
+    this->logger = logger;
+    this->pri    = pri;
+    this->name   = name;
+    len          = 0;
+}
+
+// field layout: type, key pointer, value
+LogEvent& LogEvent::put(uint8_t type, const char* key, const void* value, uint8_t size) {
+    if (len + 1 + sizeof(key) + size > LOG_EVENT_SIZE) return *this;
+
+    data[len++] = type;
+    memcpy(data + len, &key, sizeof(key));
+    len += sizeof(key);
+    memcpy(data + len, value, size);
+    len += size;
+    return *this;
+}
+
+LogEvent& LogEvent::kv(const char* key, long value) {
+    int32_t v = value;
+    return put(LOG_KV_INT, key, &v, sizeof(v));
+}
+
+LogEvent& LogEvent::kv(const char* key, unsigned long value) {
+    uint32_t v = value;
+    return put(LOG_KV_UINT, key, &v, sizeof(v));
+}
+
+LogEvent& LogEvent::kv(const char* key, double value) {
+    float v = value;
+    return put(LOG_KV_FLOAT, key, &v, sizeof(v));
+}
+
+LogEvent& LogEvent::kv(const char* key, bool value) {
+    uint8_t v = value;
+    return put(LOG_KV_BOOL, key, &v, sizeof(v));
+}
+
+// string values are copied with a length byte in front, truncated to what is left
+LogEvent& LogEvent::kv(const char* key, const char* value) {
+    if (len + 1 + sizeof(key) + 1 > LOG_EVENT_SIZE) return *this;
+
+    size_t  room = LOG_EVENT_SIZE - len - 1 - sizeof(key);
+    uint8_t buf[LOG_EVENT_SIZE];
+    size_t  n    = strlen(value);
+    if (n > room - 1) n = room - 1;
+    buf[0] = n;
+    memcpy(buf + 1, value, n);
+    return put(LOG_KV_STR, key, buf, n + 1);
+}
+
+size_t LogEvent::render(char* out, size_t size, uint8_t format) const {
+    if (size < 2) return 0;
+    LogWriter w(out, size - 1);     // room kept for the '\n'
+
+    if (format == LOG_FORMAT_JSON)        w.str("{\"event\":").jsonStr(name).str(",\"pri\":").u32(pri);
+    else if (format == LOG_FORMAT_LOGFMT) w.str("event=").str(name).str(" pri=").u32(pri);
+    else                                  w.str(name);
+
+    for (uint8_t pos = 0; pos < len; ) {
+        uint8_t     type = data[pos++];
+        const char* key;
+        memcpy(&key, data + pos, sizeof(key));
+        pos += sizeof(key);
+
+        if (format == LOG_FORMAT_JSON) w.chr(',').jsonStr(key).chr(':');
+        else                           w.chr(' ').str(key).chr('=');
+
+        switch (type) {
+            case LOG_KV_INT: {
+                int32_t v;
+                memcpy(&v, data + pos, sizeof(v));
+                pos += sizeof(v);
+                w.i32(v);
+                break;
+            }
+            case LOG_KV_UINT: {
+                uint32_t v;
+                memcpy(&v, data + pos, sizeof(v));
+                pos += sizeof(v);
+                w.u32(v);
+                break;
+            }
+            case LOG_KV_FLOAT: {
+                float v;
+                memcpy(&v, data + pos, sizeof(v));
+                pos += sizeof(v);
+                if ((format == LOG_FORMAT_JSON) && (isnan(v) || isinf(v))) w.str("null");
+                else w.flt(v);
+                break;
+            }
+            case LOG_KV_BOOL:
+                w.str(data[pos++] ? "true" : "false");
+                break;
+
+            default: {  // LOG_KV_STR
+                uint8_t     n = data[pos++];
+                const char* s = (const char*) data + pos;
+                pos += n;
+                if (format == LOG_FORMAT_JSON) {
+                    char tmp[LOG_EVENT_SIZE];
+                    memcpy(tmp, s, n);
+                    tmp[n] = '\0';
+                    w.jsonStr(tmp);
+                } else if ((format == LOG_FORMAT_LOGFMT) && (memchr(s, ' ', n) || memchr(s, '=', n) || memchr(s, '"', n))) {
+                    w.chr('"');
+                    for (uint8_t i=0; i<n; i++) {
+                        if ((s[i] == '"') || (s[i] == '\\')) w.chr('\\');
+                        w.chr(s[i]);
+                    }
+                    w.chr('"');
+                } else
+                    w.str(s, n);
+                break;
+            }
+        }
+    }
+
+    if (format == LOG_FORMAT_JSON) w.chr('}');
+    size_t n = w.length();
+    out[n++] = '\n';
+    out[n]   = '\0';
+    return n;
+}
@@ -0,0 +1,60 @@
+#ifndef LOG_EVENT_H
+#define LOG_EVENT_H
+
+#include <Arduino.h>
+
+#define LOG_EVENT_SIZE      96      // encoded fields of one event
+
+// field types
+#define LOG_KV_INT          1
+#define LOG_KV_UINT         2
+#define LOG_KV_FLOAT        3
+#define LOG_KV_BOOL         4
+#define LOG_KV_STR          5
+
+// renderings
+#define LOG_FORMAT_TEXT     0       // motor rpm=1200 temp=41.5
+#define LOG_FORMAT_LOGFMT   1       // event=motor pri=6 rpm=1200 temp=41.5
+#define LOG_FORMAT_JSON     2       // {"event":"motor","pri":6,"rpm":1200,"temp":41.5}
+#define LOG_FORMAT_BINARY   3       // COBS framed record, Serial only, see LogBinary.h
+
+class Logger;
+class LogBinary;
+
+/**
+ * Structured log record built by Logger::event()
+ * Fields are stored typed, keys must be string literals (only the pointer is kept), string values are copied.
+ * Integers are kept on 32 bits and floating point values as float, about 7 significant digits.
+ * The event is sent to the sinks when the temporary is destroyed, i.e. at the end of the statement:
+ *   Log.event(LOG_INFO, "motor").kv("rpm", 1200).kv("temp", 41.5);
+ */
+class LogEvent {
+private:
+    Logger*     logger;
+    const char* name;
+    uint8_t     pri;
+    uint8_t     len;
+    uint8_t     data[LOG_EVENT_SIZE];
+
+    friend class LogBinary;
+    LogEvent&   put(uint8_t type, const char* key, const void* value, uint8_t size);
+
+public:
+                LogEvent(Logger* logger, uint8_t pri, const char* name);
+                LogEvent(const LogEvent&) = delete;
+                ~LogEvent();
+
+    LogEvent&   kv(const char* key, int value)            { return kv(key, (long) value); };
+    LogEvent&   kv(const char* key, long value);
+    LogEvent&   kv(const char* key, unsigned int value)   { return kv(key, (unsigned long) value); };
+    LogEvent&   kv(const char* key, unsigned long value);
+    LogEvent&   kv(const char* key, double value);        // kept as float
+    LogEvent&   kv(const char* key, bool value);
+    LogEvent&   kv(const char* key, const char* value);
+
+    uint8_t     getPri() const  { return pri; };
+    const char* getName() const { return name; };
+    size_t      render(char* out, size_t size, uint8_t format) const;    // one line, '\n' terminated
+};
+
+#endif
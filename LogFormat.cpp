@@ -0,0 +1,448 @@
+#include "LogFormat.h"
+#include <math.h>
+#ifdef LOG_HEX_SSE2
+    #include <emmintrin.h>
+#endif
+
+static const char hexDigits[] = "0123456789abcdef";
+
+#ifdef LOG_HEX_SSE2
+// digits of 16 nibbles, one per byte: '0' + n, plus the gap up to 'a' from 10 on
+static inline __m128i hexNibbles(__m128i n) {
+    __m128i letter = _mm_cmpgt_epi8(n, _mm_set1_epi8(9));
+    return _mm_add_epi8(_mm_add_epi8(n, _mm_set1_epi8('0')), _mm_and_si128(letter, _mm_set1_epi8('a' - '0' - 10)));
+}
+
+// digits of 16 bytes, high nibble first: bytes 0 to 7 in lo, 8 to 15 in hi
+static inline void hexBytes(__m128i v, __m128i& lo, __m128i& hi) {
+    __m128i mask = _mm_set1_epi8(0x0F);
+    __m128i high = hexNibbles(_mm_and_si128(_mm_srli_epi16(v, 4), mask));
+    __m128i low  = hexNibbles(_mm_and_si128(v, mask));
+    lo = _mm_unpacklo_epi8(high, low);
+    hi = _mm_unpackhi_epi8(high, low);
+}
+#endif
+
+LogWriter::LogWriter(char* buf, size_t size) {
+    this->buf  = buf;
+    this->size = size;
+    len        = 0;
+    if (size) buf[0] = '\0';
+}
+
+LogWriter& LogWriter::chr(char c) {
+    if (len + 1 < size) {
+        buf[len++] = c;
+        buf[len]   = '\0';
+    }
+    return *this;
+}
+
+LogWriter& LogWriter::str(const char* s) {
+    while (*s && (len + 1 < size)) buf[len++] = *s++;
+    if (size) buf[len] = '\0';
+    return *this;
+}
+
+LogWriter& LogWriter::str(const char* s, size_t n) {
+    while (n-- && (len + 1 < size)) buf[len++] = *s++;
+    if (size) buf[len] = '\0';
+    return *this;
+}
+
+LogWriter& LogWriter::jsonStr(const char* s) {
+    chr('"');
+    for (; *s; s++) {
+        switch (*s) {
+            case '"':  str("\\\""); break;
+            case '\\': str("\\\\"); break;
+            case '\n': str("\\n");  break;
+            case '\r': str("\\r");  break;
+            case '\t': str("\\t");  break;
+            default:
+                if ((uint8_t) *s < 0x20) str("\\u00").hex((uint8_t) *s, 2);
+                else chr(*s);
+        }
+    }
+    return chr('"');
+}
+
+LogWriter& LogWriter::u32(uint32_t value) {
+    char  digits[10];
+    uint8_t n = 0;
+
+    do {
+        digits[n++] = '0' + value % 10;
+        value /= 10;
+    } while (value);
+    while (n) chr(digits[--n]);
+    return *this;
+}
+
+LogWriter& LogWriter::i32(int32_t value) {
+    if (value < 0) {
+        chr('-');
+        return u32(0 - (uint32_t) value);
+    }
+    return u32(value);
+}
+
+LogWriter& LogWriter::hex(uint32_t value, uint8_t digits) {
+    while (digits--) chr(hexDigits[(value >> (4 * digits)) & 0x0F]);
+    return *this;
+}
+
+LogWriter& LogWriter::flt(float value, uint8_t decimals) {
+    if (isnan(value)) return str("nan");
+    if (isinf(value)) return str(value < 0 ? "-inf" : "inf");
+
+    if (value < 0) {
+        chr('-');
+        value = -value;
+    }
+    if (value >= 4294967296.0f) return dbl("%.6g", value);      // beyond the fixed point range
+
+    uint32_t scale = 1;
+    for (uint8_t i=0; i<decimals; i++) scale *= 10;
+
+    // rounded fixed point, then integer and fractional parts printed separately
+    uint32_t whole = (uint32_t) value;
+    uint32_t frac  = (uint32_t) ((value - whole) * scale + 0.5f);
+    if (frac >= scale) {
+        whole++;
+        frac -= scale;
+    }
+    u32(whole);
+    if (decimals == 0) return *this;
+
+    // at least one decimal, trailing zeros removed
+    uint8_t n = decimals;
+    while ((n > 1) && (frac % 10 == 0)) {
+        frac /= 10;
+        n--;
+    }
+    chr('.');
+    uint32_t div = 1;
+    for (uint8_t i=1; i<n; i++) div *= 10;
+    for (; div; div /= 10) chr('0' + (frac / div) % 10);
+    return *this;
+}
+
+/* One double conversion through snprintf, written in place */
+LogWriter& LogWriter::dbl(const char* spec, double value) {
+    if (len + 1 >= size) return *this;
+    int n = snprintf(buf + len, size - len, spec, value);
+    if (n > 0) len = std::min(len + n, size - 1);
+    return *this;
+}
+
+char* LogHex::word(char* out, uint32_t value) {
+#ifdef LOG_HEX_SSE2
+    __m128i lo, hi;
+    hexBytes(_mm_cvtsi32_si128(__builtin_bswap32(value)), lo, hi);
+    _mm_storel_epi64((__m128i*) out, lo);
+#else
+    out[0] = hexDigits[value >> 28];
+    out[1] = hexDigits[(value >> 24) & 0x0F];
+    out[2] = hexDigits[(value >> 20) & 0x0F];
+    out[3] = hexDigits[(value >> 16) & 0x0F];
+    out[4] = hexDigits[(value >> 12) & 0x0F];
+    out[5] = hexDigits[(value >> 8) & 0x0F];
+    out[6] = hexDigits[(value >> 4) & 0x0F];
+    out[7] = hexDigits[value & 0x0F];
+#endif
+    return out + 8;
+}
+
+char* LogHex::bytes(char* out, const uint8_t* data, size_t len, char separator) {
+#ifdef LOG_HEX_SSE2
+    for (; len >= 16; len -= 16, data += 16) {
+        __m128i lo, hi;
+        hexBytes(_mm_loadu_si128((const __m128i*) data), lo, hi);
+        if (!separator) {
+            _mm_storeu_si128((__m128i*) out, lo);
+            _mm_storeu_si128((__m128i*) (out + 16), hi);
+            out += 32;
+            continue;
+        }
+        // no byte shuffle in SSE2, the separators are put in while copying the digits
+        char digits[32];
+        _mm_storeu_si128((__m128i*) digits, lo);
+        _mm_storeu_si128((__m128i*) (digits + 16), hi);
+        for (uint8_t i=0; i<32; i+=2) {
+            *out++ = digits[i];
+            *out++ = digits[i + 1];
+            *out++ = separator;
+        }
+    }
+#endif
+    for (size_t i=0; i<len; i++) {
+        *out++ = hexDigits[data[i] >> 4];
+        *out++ = hexDigits[data[i] & 0x0F];
+        if (separator) *out++ = separator;
+    }
+    return out;
+}
+
+/* A short last row is padded so that its text column lines up with the others */
+size_t LogHex::line(char* out, uint32_t address, const uint8_t* data, size_t len) {
+    char* p = word(out, address);
+
+    if (len > LOG_HEX_LINE_BYTES) len = LOG_HEX_LINE_BYTES;
+    *p++ = ':';
+    *p++ = ' ';
+    p = bytes(p, data, len, ' ');
+    for (size_t i=len; i<LOG_HEX_LINE_BYTES; i++, p += 3) memcpy(p, "   ", 3);
+    *p++ = ' ';
+#ifdef LOG_HEX_SSE2
+    if (len == LOG_HEX_LINE_BYTES) {
+        // printable: 0x20 to 0x7e, bytes from 0x80 up are negative for the signed compares
+        __m128i v         = _mm_loadu_si128((const __m128i*) data);
+        __m128i printable = _mm_and_si128(_mm_cmpgt_epi8(v, _mm_set1_epi8(0x1F)), _mm_cmplt_epi8(v, _mm_set1_epi8(0x7F)));
+        _mm_storeu_si128((__m128i*) p, _mm_or_si128(_mm_and_si128(printable, v), _mm_andnot_si128(printable, _mm_set1_epi8('.'))));
+        p  += LOG_HEX_LINE_BYTES;
+        len = 0;
+    }
+#endif
+    for (size_t i=0; i<len; i++) *p++ = ((data[i] >= 0x20) && (data[i] < 0x7F)) ? data[i] : '.';
+    *p++ = '\n';
+    *p   = '\0';
+    return p - out;
+}
+
+// conversion of one LogFmt::format() specification
+typedef struct {
+    char        conv;
+    bool        left;               // '-'
+    bool        zero;               // '0'
+    bool        plus;               // '+'
+    bool        space;              // ' '
+    bool        alt;                // '#'
+    uint8_t     width;
+    int8_t      precision;          // -1 when not given
+} tLogSpec;
+
+/* Text of a conversion, padded to the width; zeros go after the lead (sign, "0x") when the number allows them */
+static void pad(LogWriter& w, const tLogSpec& spec, const char* text, size_t len, size_t lead, bool zeros) {
+    size_t fill = (spec.width > len) ? spec.width - len : 0;
+
+    if (spec.left) {
+        w.str(text, len);
+        while (fill--) w.chr(' ');
+        return;
+    }
+    if ((spec.zero) && (zeros)) {
+        w.str(text, lead);
+        while (fill--) w.chr('0');
+        w.str(text + lead, len - lead);
+        return;
+    }
+    while (fill--) w.chr(' ');
+    w.str(text, len);
+}
+
+/* Sign of a signed conversion, '+' and ' ' flags included */
+static void sign(LogWriter& t, const tLogSpec& spec, bool negative) {
+    if (negative)        t.chr('-');
+    else if (spec.plus)  t.chr('+');
+    else if (spec.space) t.chr(' ');
+}
+
+static void integer(LogWriter& w, const tLogSpec& spec, const LogArg& arg) {
+    static const char upper[] = "0123456789ABCDEF";
+    char              text[48];
+    LogWriter         t(text, sizeof(text));
+    uint64_t          value = arg.u;
+    bool              hex   = (spec.conv == 'x') || (spec.conv == 'X');
+    bool              octal = (spec.conv == 'o');
+    bool              signd = (spec.conv == 'd') || (spec.conv == 'i');
+
+    if (spec.conv == 'c') {
+        t.chr((char) value);
+        return pad(w, spec, text, t.length(), 0, false);
+    }
+    // a negative value is shown as its two's complement by %u %x %o
+    bool negative = (arg.kind == 'i') && (arg.i < 0);
+    if ((negative) && (!signd)) {
+        if (arg.size < 8) value &= 0xFFFFFFFF;     // promoted to int, as printf does
+        negative = false;
+    }
+    if (negative) value = 0 - (uint64_t) arg.i;
+
+    // digits, least significant first
+    char    digits[24];
+    uint8_t n    = 0;
+    uint8_t base = hex ? 16 : octal ? 8 : 10;
+    while (value) {
+        digits[n++] = ((spec.conv == 'X') ? upper : hexDigits)[value % base];
+        value /= base;
+    }
+    uint8_t least = (spec.precision < 0) ? 1 : std::min((int) spec.precision, 40);
+    if ((octal) && (spec.alt) && (least <= n)) least = n + 1;      // leading 0
+    if (signd) sign(t, spec, negative);
+    if ((hex) && (spec.alt) && (n)) t.chr('0').chr(spec.conv);
+    size_t lead = t.length();
+    for (uint8_t i=n; i<least; i++) t.chr('0');
+    while (n) t.chr(digits[--n]);
+    pad(w, spec, text, t.length(), lead, spec.precision < 0);
+}
+
+/**
+ * %f with up to 9 decimals of a value below 2^64, rounded as printf does: the fractional part times the scale is
+ * exact with its fma() remainder, so ties are told from values just above or below them, and ties go to even.
+ * Other cases (%e %g %a, larger values, more decimals) go through snprintf, one conversion at a time.
+ */
+static void real(LogWriter& w, const tLogSpec& spec, double value) {
+    char      text[48];
+    LogWriter t(text, sizeof(text));
+    char      conv     = spec.conv;
+    bool      negative = signbit(value);
+    int       decimals = (spec.precision < 0) ? 6 : spec.precision;
+    double    mag      = fabs(value);
+
+    if ((isnan(value)) || (isinf(value))) {
+        sign(t, spec, negative);
+        bool upper = (conv == 'F') || (conv == 'E') || (conv == 'G') || (conv == 'A');
+        t.str(isnan(value) ? (upper ? "NAN" : "nan") : (upper ? "INF" : "inf"));
+        return pad(w, spec, text, t.length(), 0, false);
+    }
+    if (((conv != 'f') && (conv != 'F')) || (decimals > 9) || (mag >= 18446744073709551616.0)) {
+        char      f[24];
+        LogWriter s(f, sizeof(f));
+        s.chr('%');
+        if (spec.left)  s.chr('-');
+        if (spec.zero)  s.chr('0');
+        if (spec.plus)  s.chr('+');
+        if (spec.space) s.chr(' ');
+        if (spec.alt)   s.chr('#');
+        if (spec.width) s.u32(spec.width);
+        if (spec.precision >= 0) s.chr('.').u32(spec.precision);      // %a without one is exact
+        s.chr(conv);
+        w.dbl(f, value);
+        return;
+    }
+
+    uint32_t scale = 1;
+    for (int i=0; i<decimals; i++) scale *= 10;
+    uint64_t whole = (uint64_t) mag;
+    double   frac  = mag - (double) whole;          // exact
+    double   p     = frac * scale;
+    double   error = fma(frac, scale, -p);           // frac * scale == p + error exactly
+    uint64_t units = (uint64_t) p;
+    double   rest  = p - (double) units;             // exact, in [0, 1)
+    if ((rest > 0.5) || ((rest == 0.5) && ((error > 0) || ((error == 0) && ((decimals ? units : whole) & 1))))) units++;
+    if (units >= scale) {
+        units -= scale;
+        whole++;
+    }
+
+    sign(t, spec, negative);
+    size_t lead = t.length();
+    char    digits[20];
+    uint8_t n = 0;
+    do {
+        digits[n++] = '0' + whole % 10;
+        whole /= 10;
+    } while (whole);
+    while (n) t.chr(digits[--n]);
+    if ((decimals) || (spec.alt)) t.chr('.');
+    for (uint32_t div = scale / 10; div; div /= 10) t.chr('0' + (units / div) % 10);
+    pad(w, spec, text, t.length(), lead, true);
+}
+
+static void convert(LogWriter& w, const tLogSpec& spec, const LogArg& arg) {
+    bool floating = (spec.conv == 'f') || (spec.conv == 'F') || (spec.conv == 'e') || (spec.conv == 'E') ||
+                    (spec.conv == 'g') || (spec.conv == 'G') || (spec.conv == 'a') || (spec.conv == 'A');
+    switch (arg.kind) {
+        case 'i':
+        case 'u':
+            if (floating) return real(w, spec, (arg.kind == 'i') ? (double) arg.i : (double) arg.u);
+            return integer(w, spec, arg);
+        case 'f':
+            if (floating) return real(w, spec, arg.f);
+            {
+                tLogSpec f = spec;
+                f.conv = 'f';
+                return real(w, f, arg.f);
+            }
+        case 's':
+            if (spec.conv != 'p') {
+                const char* s   = arg.s ? arg.s : "(null)";
+                size_t      len = strlen(s);
+                if ((spec.precision >= 0) && ((size_t) spec.precision < len)) len = spec.precision;
+                return pad(w, spec, s, len, 0, false);
+            }
+            // fall through, %p of a string
+        default: {
+            char      text[20];
+            LogWriter t(text, sizeof(text));
+            uint32_t  value = (uint32_t) (uintptr_t) arg.p;
+            uint8_t   n     = 1;
+            while ((n < 8) && (value >> (4 * n))) n++;
+            t.str("0x").hex(value, n);
+            pad(w, spec, text, t.length(), 0, false);
+        }
+    }
+}
+
+/**
+ * Format string walked once, literal text copied in runs.
+ * A conversion without an argument is written as is, arguments without a conversion are ignored.
+ */
+size_t LogFmt::format(LogWriter& w, const char* fmt, const LogArg* args, uint8_t count) {
+    uint8_t n = 0;
+
+    while (*fmt) {
+        const char* run = fmt;
+        while ((*fmt) && (*fmt != '%')) fmt++;
+        if (fmt > run) w.str(run, fmt - run);
+        if (!*fmt) break;
+
+        const char* start = fmt++;
+        if (*fmt == '%') {
+            w.chr('%');
+            fmt++;
+            continue;
+        }
+
+        tLogSpec spec = { 0, false, false, false, false, false, 0, -1 };
+        for (;; fmt++) {
+            if (*fmt == '-') spec.left = true;
+            else if (*fmt == '0') spec.zero = true;
+            else if (*fmt == '+') spec.plus = true;
+            else if (*fmt == ' ') spec.space = true;
+            else if (*fmt == '#') spec.alt = true;
+            else break;
+        }
+        // '*' takes the width or the precision from the next argument, a negative width left justifies
+        int width = 0;
+        if (*fmt == '*') {
+            fmt++;
+            width = (n < count) ? (int) args[n++].i : 0;
+            if (width < 0) {
+                spec.left = true;
+                width     = -width;
+            }
+        }
+        while ((*fmt >= '0') && (*fmt <= '9')) width = width * 10 + (*fmt++ - '0');
+        spec.width = std::min(width, 255);
+        if (*fmt == '.') {
+            int precision = 0;
+            if (*++fmt == '*') {
+                fmt++;
+                precision = (n < count) ? (int) args[n++].i : -1;
+            }
+            while ((*fmt >= '0') && (*fmt <= '9')) precision = precision * 10 + (*fmt++ - '0');
+            spec.precision = std::max(std::min(precision, 127), -1);
+        }
+        if (spec.left) spec.zero = false;
+        if (spec.plus) spec.space = false;
+        while ((*fmt == 'l') || (*fmt == 'h') || (*fmt == 'z') || (*fmt == 'j') || (*fmt == 't') || (*fmt == 'L')) fmt++;
+        if (!*fmt) break;
+        spec.conv = *fmt++;
+
+        if (n < count) convert(w, spec, args[n++]);
+        else w.str(start, fmt - start);
+    }
+    return w.length();
+}
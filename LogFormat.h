@@ -0,0 +1,144 @@
+#ifndef LOG_FORMAT_H
+#define LOG_FORMAT_H
+
+#include <Arduino.h>
+#include <type_traits>
+
+/**
+ * Bounded text writer with integer, hexadecimal and float conversions, no vsnprintf involved
+ * The text is always NUL terminated, what does not fit is dropped
+ */
+class LogWriter {
+private:
+    char*       buf;
+    size_t      size;
+    size_t      len;
+
+public:
+                LogWriter(char* buf, size_t size);
+    LogWriter&  chr(char c);
+    LogWriter&  str(const char* s);
+    LogWriter&  str(const char* s, size_t n);
+    LogWriter&  jsonStr(const char* s);                     // quoted and escaped
+    LogWriter&  u32(uint32_t value);
+    LogWriter&  i32(int32_t value);
+    LogWriter&  hex(uint32_t value, uint8_t digits = 8);
+    LogWriter&  flt(float value, uint8_t decimals = 3);     // trailing zeros removed, %.6g from 2^32 up
+    LogWriter&  dbl(const char* spec, double value);        // snprintf of a single conversion, e.g. "%.3e"
+    size_t      length()    { return len; };
+    bool        full()      { return len + 1 >= size; };
+    const char* c_str()     { return buf; };
+};
+
+#define LOG_HEX_LINE_BYTES    16      // bytes per LogHex::line() row
+#define LOG_HEX_LINE_SIZE     80      // room for a LogHex::line() row, NUL included
+
+// host builds (tests/) convert 16 bytes at a time with SSE2, LOG_HEX_SCALAR keeps the table as on the ESP
+#if defined(__SSE2__) && !defined(LOG_HEX_SCALAR)
+    #define LOG_HEX_SSE2
+#endif
+
+/**
+ * Table driven hexadecimal, lower case, for crash stacks and Log.hexdump()
+ * The 16 digit table costs no RAM worth speaking of, a 512 bytes pair table would on the ESP8266.
+ */
+class LogHex {
+public:
+    static char*    word(char* out, uint32_t value);                                // 8 digits, returns the end
+    static char*    bytes(char* out, const uint8_t* data, size_t len, char separator = 0);   // 2 digits per byte
+    // "3ffe8a20: 48 65 6c ... 0a  Hello world.....\n", up to 16 bytes, NUL terminated, returns the length
+    static size_t   line(char* out, uint32_t address, const uint8_t* data, size_t len);
+};
+
+/**
+ * Kind of a Log.print() argument: 'i' signed or 'u' unsigned integer, 'f' float, 's' text, 'p' pointer, 0 not printable
+ */
+template<typename T> constexpr char logArgKind() {
+    return (std::is_same<T, char*>::value || std::is_same<T, const char*>::value || std::is_same<T, String>::value) ? 's'
+         : std::is_floating_point<T>::value ? 'f'
+         : std::is_pointer<T>::value ? 'p'
+         : ((std::is_integral<T>::value && std::is_signed<T>::value) || std::is_enum<T>::value) ? 'i'
+         : std::is_integral<T>::value ? 'u' : 0;
+}
+
+/**
+ * One argument of Log.print(), tagged with its kind so that no va_list is needed
+ */
+class LogArg {
+public:
+    char        kind;
+    uint8_t     size;               // bytes of an integer, %x and %u of a negative one keep 64 bits only for 8 bytes
+    union {
+        int64_t     i;
+        uint64_t    u;
+        double      f;
+        const char* s;
+        const void* p;
+    };
+
+                LogArg() : kind(0), size(0), u(0) {};
+                LogArg(const char* value) : kind('s'), size(0), s(value) {};
+                LogArg(const String& value) : kind('s'), size(0), s(value.c_str()) {};
+                LogArg(const void* value) : kind('p'), size(0), p(value) {};
+                LogArg(double value) : kind('f'), size(0), f(value) {};
+    template<typename T, typename std::enable_if<std::is_integral<T>::value || std::is_enum<T>::value, int>::type = 0>
+                LogArg(T value) : kind(logArgKind<T>()), size(sizeof(T)) {
+                    if (kind == 'i') i = (int64_t) value;
+                    else u = (uint64_t) value;
+                };
+};
+
+// kinds of the arguments as a string, for LOG_FORMAT_CHECK
+template<char... K> struct LogArgKinds {
+    static constexpr char kinds[sizeof...(K) + 1] = { K..., 0 };
+};
+template<char... K> constexpr char LogArgKinds<K...>::kinds[];
+
+/**
+ * printf formatting on LogWriter, for Log.print() and WebSerial.printf(), with the output of snprintf.
+ * Conversions: %d %i %u %o %x %X %c %s %p %f %F %e %E %g %G %a %A %%, flags '-' '0' '+' ' ' '#', width and
+ * precision, '*' for either; length modifiers are accepted and ignored since the arguments carry their size.
+ * Integers and %f up to 9 decimals are converted here, the other floating point cases by snprintf.
+ * The conversion code is picked from the argument types, a wrong type cannot read past the arguments.
+ */
+class LogFmt {
+private:
+    static constexpr bool isSpec(char c) {
+        return ((c >= '0') && (c <= '9')) || (c == '-') || (c == '+') || (c == ' ') || (c == '#') || (c == '.')
+            || (c == 'l') || (c == 'h') || (c == 'z') || (c == 'j') || (c == 't') || (c == 'L');
+    }
+    static constexpr bool isFloat(char conv) {
+        return (conv == 'f') || (conv == 'F') || (conv == 'e') || (conv == 'E') || (conv == 'g') || (conv == 'G') || (conv == 'a') || (conv == 'A');
+    }
+    static constexpr bool accepts(char conv, char kind) {
+        return ((conv == 'd') || (conv == 'i') || (conv == 'u') || (conv == 'o') || (conv == 'x') || (conv == 'X') || (conv == 'c')) ? ((kind == 'i') || (kind == 'u'))
+             : isFloat(conv) ? (kind == 'f')
+             : (conv == 's') ? (kind == 's')
+             : (conv == 'p') ? ((kind == 'p') || (kind == 's'))
+             : false;
+    }
+    // rest of a conversion after '%', a '*' takes an integer argument
+    static constexpr bool spec(const char* f, const char* k) {
+        return (*f == '*') ? (((*k == 'i') || (*k == 'u')) && spec(f + 1, k + 1))
+             : isSpec(*f) ? spec(f + 1, k)
+             : ((*k) && accepts(*f, *k)) ? check(f + 1, k + 1)
+             : false;
+    }
+
+public:
+    // true when the conversions of fmt take the kinds in that order, evaluated by the compiler
+    static constexpr bool check(const char* f, const char* k) {
+        return (*f == '\0') ? (*k == '\0')
+             : (*f != '%') ? check(f + 1, k)
+             : (f[1] == '%') ? check(f + 2, k)
+             : spec(f + 1, k);
+    }
+    template<typename... A> static LogArgKinds<logArgKind<typename std::decay<A>::type>()...> kinds(const A&...);   // for decltype only
+
+    static size_t format(LogWriter& w, const char* fmt, const LogArg* args, uint8_t count);
+};
+
+// fails the build when the format string does not match the arguments, the format must be a literal
+#define LOG_FORMAT_CHECK(fmt, ...)  static_assert(LogFmt::check(fmt, decltype(LogFmt::kinds(__VA_ARGS__))::kinds), "format does not match the arguments: " fmt)
+
+#endif
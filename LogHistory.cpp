@@ -0,0 +1,475 @@
+#include "LogHistory.h"
+
+// reservations may come from interrupts, the sections only cover the open block bookkeeping
+#if defined(ESP32)
+    static portMUX_TYPE historyMux = portMUX_INITIALIZER_UNLOCKED;
+    #define HISTORY_LOCK()      portENTER_CRITICAL(&historyMux)
+    #define HISTORY_UNLOCK()    portEXIT_CRITICAL(&historyMux)
+#else
+    #define HISTORY_LOCK()      uint32_t savedPS = xt_rsil(15)
+    #define HISTORY_UNLOCK()    xt_wsr_ps(savedPS)
+#endif
+
+static_assert(LOG_COMPRESS_HASH <= LOG_HISTORY_BLOCK, "the hash table shares the scratch with a decompressed block");
+
+LogHistory::LogHistory(void* memory, size_t size, bool compress) {
+    compress     = (compress) && (size >= LOG_HISTORY_COMPRESS_MIN);
+    size_t fixed = LOG_HISTORY_BLOCK + scratchSize(compress);
+
+    // an index entry for each 64 bytes of sealed blocks, more than a block header with a few records
+    size_t rest = (size > fixed) ? size - fixed : 0;
+
+    open      = (uint8_t*) memory;
+    scratch   = open + LOG_HISTORY_BLOCK;
+    index     = (uint16_t*) (scratch + scratchSize(compress));
+    indexSize = std::max(rest / (64 + sizeof(uint16_t)), (size_t) 1);
+    data      = (uint8_t*) (index + indexSize);
+    dataSize  = (rest > indexSize * sizeof(uint16_t)) ? rest - indexSize * sizeof(uint16_t) : 0;
+
+    this->compress = compress;
+    rawBytes      = 0;
+    storedBytes   = 0;
+    sealedRecords = 0;
+    cycles        = 0;
+    lastSeq       = 0;
+    lastMs        = 0;
+    droppedSeq    = 0;
+    ratio         = 256;
+    kept          = NULL;
+    keptPri       = 0;
+    clear();
+}
+
+size_t LogHistory::minSize(bool compress) {
+    size_t block = sizeof(tHistoryBlock) + LOG_HISTORY_BLOCK;
+    return LOG_HISTORY_BLOCK + scratchSize(compress) + block + (block / 64 + 2) * sizeof(uint16_t);
+}
+
+/* The kept history is not compressed, the main one must still hold a sealed block */
+size_t LogHistory::keptSize(size_t size, uint8_t percent, bool compress) {
+    if (!percent) return 0;
+    size_t kept = (std::max(size * percent / 100, minSize(false)) + 3) & ~(size_t) 3;
+    return (size >= kept + minSize(compress)) ? kept : 0;
+}
+
+void LogHistory::clear() {
+    openLen     = 0;
+    openRecords = 0;
+    pending     = 0;
+    sealing     = false;
+    openFirst   = 0;
+    openFirstMs = 0;
+    memset(openSummary, 0, sizeof(openSummary));
+    head        = 0;
+    tail        = 0;
+    count       = 0;
+    indexFirst  = 0;
+    droppedSeq  = lastSeq;
+}
+
+void LogHistory::add(uint32_t seq, uint32_t ms, uint8_t pri, const char* msg, size_t len) {
+    size_t capacity;
+    char*  text = reserve(len, len, capacity);
+    if (!text) return;
+
+    len = std::min(len, capacity);
+    memcpy(text, msg, len);
+    commit(text, seq, ms, pri, len);
+}
+
+/**
+ * Seals the open block when len bytes of text do not fit, false when it cannot be sealed now.
+ * Compressing and moving records to the kept history take too long for a critical section:
+ * the block is sealed outside of it, reservations fail meanwhile.
+ */
+bool LogHistory::makeRoom(size_t len) {
+    bool full, mine;
+    {
+        HISTORY_LOCK();
+        full = openLen + sizeof(tHistoryRecord) + len > LOG_HISTORY_BLOCK;
+        mine = (full) && (!pending) && (!sealing);
+        if (mine) sealing = true;
+        HISTORY_UNLOCK();
+    }
+    if (!full) return true;
+    if (!mine) return false;
+
+    seal();
+    sealing = false;
+    return true;
+}
+
+char* LogHistory::reserve(size_t minLen, size_t maxLen, size_t& capacity) {
+    size_t most = LOG_HISTORY_BLOCK - sizeof(tHistoryRecord);
+    minLen = std::min(minLen, most);
+    maxLen = std::max(std::min(maxLen, most), minLen);
+    if (!makeRoom(minLen)) return NULL;
+
+    // an interrupt may have taken the room since
+    HISTORY_LOCK();
+    if ((sealing) || (openLen + sizeof(tHistoryRecord) + minLen > LOG_HISTORY_BLOCK)) {
+        HISTORY_UNLOCK();
+        return NULL;
+    }
+
+    capacity = std::min(maxLen, LOG_HISTORY_BLOCK - openLen - sizeof(tHistoryRecord));
+    tHistoryRecord r = { 0, 0, (uint16_t) capacity, LOG_HISTORY_RESERVED, 0 };
+    uint8_t* at = open + openLen;
+    memcpy(at, &r, sizeof(r));
+    openLen += sizeof(r) + capacity;
+    pending++;
+    HISTORY_UNLOCK();
+
+    return (char*) at + sizeof(r);
+}
+
+/* The room not used goes back to the block when this is the last record, else it is skipped by the readers */
+void LogHistory::commit(char* text, uint32_t seq, uint32_t ms, uint8_t pri, size_t len) {
+    uint8_t*       at = (uint8_t*) text - sizeof(tHistoryRecord);
+    tHistoryRecord r;
+
+    HISTORY_LOCK();
+    memcpy(&r, at, sizeof(r));
+    bool   last = (at + sizeof(r) + r.len == open + openLen);
+    len         = std::min(len, (size_t) r.len);
+    size_t left = r.len - len;
+
+    if ((last) && (pri == LOG_HISTORY_FILLER)) {
+        openLen = at - open;
+    } else {
+        tHistoryRecord c = { seq, ms, (uint16_t) len, pri, 0 };
+        if (last) openLen -= left;
+        else if (left < sizeof(tHistoryRecord)) c.pad = left;
+        else {
+            tHistoryRecord filler = { 0, 0, (uint16_t) (left - sizeof(filler)), LOG_HISTORY_FILLER, 0 };
+            memcpy(text + len, &filler, sizeof(filler));
+        }
+        memcpy(at, &c, sizeof(c));
+
+        if (pri != LOG_HISTORY_FILLER) {
+            summarize(openSummary, text, len);
+            if (!openRecords) {
+                openFirst   = seq;
+                openFirstMs = ms;
+            }
+            openRecords++;
+            lastSeq = seq;
+            lastMs  = ms;
+        }
+    }
+    pending--;
+    HISTORY_UNLOCK();
+}
+
+/* Position of the block header at pos, after the wrap if there is one */
+uint16_t LogHistory::valid(uint16_t pos) {
+    if (pos + sizeof(tHistoryBlock) > dataSize) return 0;
+    if (block(pos).length == 0xFFFF) return 0;
+    return pos;
+}
+
+void LogHistory::drop() {
+    tail = valid(tail);
+    droppedSeq = block(tail).lastSeq;
+
+    // the records worth keeping go on to the kept history, older than any record left here
+    if (kept) {
+        size_t         len;
+        const uint8_t* recs = records(tail, block(tail), len);
+        walk(recs, len, 0, [&](const tHistoryRecord &record, const char *text) -> bool {
+            if (record.pri <= keptPri) kept->add(record.seq, record.ms, record.pri, text, record.len);
+            return true;
+        });
+    }
+    tail = tail + sizeof(tHistoryBlock) + block(tail).length;
+    indexFirst = (indexFirst + 1) % indexSize;
+    if (--count == 0) head = tail = indexFirst = 0;
+    else tail = valid(tail);
+}
+
+/**
+ * Drops the oldest blocks until len bytes are free at head, wrapping to the beginning of the ring
+ * when they do not fit before the end, returns the bytes free at head
+ */
+uint16_t LogHistory::vacate(size_t len) {
+    if (head + len > dataSize) {
+        while ((count) && (tail >= head)) drop();
+        if (head + sizeof(tHistoryBlock) <= dataSize) {
+            uint16_t marker = 0xFFFF;
+            memcpy(data + head, &marker, sizeof(marker));
+        }
+        head = 0;
+    }
+    // oldest blocks overlapped by the new one, or no index entry left
+    while ((count) && (tail >= head) && (tail < head + len)) drop();
+    while (count >= indexSize) drop();
+    return ((count) && (tail >= head)) ? tail - head : dataSize - head;
+}
+
+/**
+ * Room is made for the block compressed as well as the last one, plus a margin, and it is compressed straight into
+ * the ring. When it does not fit, more is dropped and it is compressed again. Dropped blocks may be decompressed into
+ * the scratch area to keep their records: the hash table only takes it afterwards.
+ */
+void LogHistory::seal() {
+    if (openLen == 0) return;
+
+    if (sizeof(tHistoryBlock) + openLen > dataSize) droppedSeq = lastSeq;
+    else {
+        size_t want   = compress ? std::min((size_t) openLen, (size_t) openLen * ratio / 256 + openLen / 16) : openLen;
+        size_t length = 0;
+        while (!length) {
+            size_t   room = vacate(sizeof(tHistoryBlock) + want) - sizeof(tHistoryBlock);
+            uint8_t* to   = data + head + sizeof(tHistoryBlock);
+            if (compress) {
+                uint32_t start = ESP.getCycleCount();
+                length  = LogCompress::compress(open, openLen, to, std::min(room, (size_t) openLen), scratch);
+                cycles += ESP.getCycleCount() - start;
+            }
+            // stored as is when it does not get smaller
+            if ((!length) && (want == openLen)) {
+                length = openLen;
+                memcpy(to, open, length);
+            }
+            want = openLen;
+        }
+        ratio = length * 256 / openLen;
+
+        tHistoryBlock b = { (uint16_t) length, openLen, openRecords, openFirst, lastSeq, openFirstMs, lastMs };
+        memcpy(b.summary, openSummary, sizeof(b.summary));
+        memcpy(data + head, &b, sizeof(b));
+        index[(indexFirst + count) % indexSize] = head;
+        head += sizeof(b) + length;
+        count++;
+
+        rawBytes      += openLen;
+        storedBytes   += length;
+        sealedRecords += openRecords;
+    }
+
+    openLen     = 0;
+    openRecords = 0;
+    memset(openSummary, 0, sizeof(openSummary));
+}
+
+bool LogHistory::walk(const uint8_t* records, size_t len, uint32_t since, HistoryHandler handler) {
+    for (size_t pos = 0; pos + sizeof(tHistoryRecord) <= len; ) {
+        tHistoryRecord r;
+        memcpy(&r, records + pos, sizeof(r));
+        pos += sizeof(r);
+        if ((r.pri < LOG_HISTORY_FILLER) && ((int32_t) (r.seq - since) > 0) && (!handler(r, (const char*) records + pos))) return false;
+        pos += r.len + r.pad;
+    }
+    return true;
+}
+
+/* Records of the sealed block at pos, decompressed into the scratch area if needed */
+const uint8_t* LogHistory::records(uint16_t pos, const tHistoryBlock& b, size_t& len) {
+    const uint8_t* from = data + pos + sizeof(b);
+    if (b.length == b.raw) {
+        len = b.length;
+        return from;
+    }
+    len = LogCompress::decompress(from, b.length, scratch, LOG_HISTORY_BLOCK);
+    return scratch;
+}
+
+bool LogHistory::forEach(uint32_t since, HistoryHandler handler) {
+    if ((kept) && (!kept->forEach(since, handler))) return false;
+    uint16_t pos = tail;
+
+    for (uint16_t i=0; i<count; i++) {
+        pos = valid(pos);
+        tHistoryBlock b = block(pos);
+
+        // blocks already read are not decompressed
+        if ((int32_t) (b.lastSeq - since) > 0) {
+            size_t         len;
+            const uint8_t* from = records(pos, b, len);
+            if (!walk(from, len, since, handler)) return false;
+        }
+        pos += sizeof(b) + b.length;
+    }
+    return walk(open, openLen, since, handler);
+}
+
+/* FNV-1a of the lower case word */
+uint32_t LogHistory::wordHash(const char* word, size_t len) {
+    uint32_t hash = 2166136261UL;
+    for (size_t i=0; i<len; i++) {
+        hash ^= (uint8_t) tolower(word[i]);
+        hash *= 16777619UL;
+    }
+    return hash;
+}
+
+/* Length of the word starting at pos, after skipping what is not part of a word, 0 at the end */
+size_t LogHistory::nextWord(const char* text, size_t len, size_t& pos) {
+    while ((pos < len) && (!isalnum((uint8_t) text[pos])) && (text[pos] != '_')) pos++;
+    size_t start = pos;
+    while ((pos < len) && ((isalnum((uint8_t) text[pos])) || (text[pos] == '_'))) pos++;
+    return pos - start;
+}
+
+// two bits per word, from the two halves of its hash
+#define SUMMARY_BITS  (LOG_HISTORY_SUMMARY * 8)
+#define SUMMARY_SET(s, h)   ((s)[((h) % SUMMARY_BITS) >> 3] |= 1 << ((h) & 7))
+#define SUMMARY_GET(s, h)   ((s)[((h) % SUMMARY_BITS) >> 3] &  (1 << ((h) & 7)))
+
+void LogHistory::summarize(uint8_t* summary, const char* text, size_t len) {
+    size_t pos = 0, n;
+    while ((n = nextWord(text, len, pos)) != 0) {
+        uint32_t hash = wordHash(text + pos - n, n);
+        SUMMARY_SET(summary, hash);
+        SUMMARY_SET(summary, hash >> 16);
+    }
+}
+
+bool LogHistory::mayHold(const uint8_t* summary, const tHistoryQuery& query) {
+    for (uint8_t i=0; i<query.count; i++)
+        if ((!SUMMARY_GET(summary, query.hash[i])) || (!SUMMARY_GET(summary, query.hash[i] >> 16))) return false;
+    return true;
+}
+
+bool LogHistory::holds(const char* text, size_t len, const tHistoryQuery& query) {
+    uint8_t found = 0;      // bit per query word
+    size_t  pos   = 0, n;
+
+    while ((n = nextWord(text, len, pos)) != 0)
+        for (uint8_t i=0; i<query.count; i++)
+            if ((n == query.len[i]) && (strncasecmp(text + pos - n, query.word[i], n) == 0)) found |= 1 << i;
+    return found == (1 << query.count) - 1;
+}
+
+uint8_t LogHistory::parseQuery(const char* words, tHistoryQuery& query) {
+    size_t len = strlen(words), pos = 0, n;
+
+    query.count = 0;
+    while (((n = nextWord(words, len, pos)) != 0) && (query.count < LOG_HISTORY_WORDS)) {
+        query.word[query.count] = words + pos - n;
+        query.len[query.count]  = std::min(n, (size_t) 255);
+        query.hash[query.count] = wordHash(words + pos - n, n);
+        query.count++;
+    }
+    return query.count;
+}
+
+/* Only the blocks whose summary may hold all the words are read, the cost follows the matches */
+uint16_t LogHistory::find(const tHistoryQuery& query, HistoryHandler handler) {
+    uint16_t pos  = tail;
+    uint16_t read = 0;
+    bool     more = true;
+    if (!query.count) return 0;
+
+    auto match = [&](const tHistoryRecord &record, const char *text) -> bool {
+        return holds(text, record.len, query) ? (more = handler(record, text)) : true;
+    };
+    if (kept) read = kept->find(query, [&](const tHistoryRecord &record, const char *text) -> bool {
+        return more = handler(record, text);
+    });
+
+    for (uint16_t i=0; (i<count) && (more); i++) {
+        pos = valid(pos);
+        tHistoryBlock b = block(pos);
+
+        if (mayHold(b.summary, query)) {
+            size_t         len;
+            const uint8_t* from = records(pos, b, len);
+            walk(from, len, 0, match);
+            read++;
+        }
+        pos += sizeof(b) + b.length;
+    }
+    if ((more) && (openLen) && (mayHold(openSummary, query))) {
+        walk(open, openLen, 0, match);
+        read++;
+    }
+    return read;
+}
+
+/**
+ * The oldest block ending at from or later is found by binary search over the index,
+ * the walk stops at the first record after to. millis() values are compared as differences.
+ */
+uint16_t LogHistory::forRange(uint32_t from, uint32_t to, HistoryHandler handler) {
+    uint16_t lo   = 0, hi = count;
+    uint16_t read = 0;
+    bool     more = true;
+
+    auto inRange = [&](const tHistoryRecord &record, const char *text) -> bool {
+        if ((int32_t) (record.ms - to) > 0) return more = false;
+        return ((int32_t) (record.ms - from) < 0) ? true : (more = handler(record, text));
+    };
+    if (kept) read = kept->forRange(from, to, [&](const tHistoryRecord &record, const char *text) -> bool {
+        return more = handler(record, text);
+    });
+    if (!more) return read;
+
+    while (lo < hi) {
+        uint16_t mid = (lo + hi) / 2;
+        if ((int32_t) (block(blockAt(mid)).lastMs - from) < 0) lo = mid + 1;
+        else hi = mid;
+    }
+
+    for (uint16_t i=lo; (i<count) && (more); i++) {
+        uint16_t      pos = blockAt(i);
+        tHistoryBlock b   = block(pos);
+        if ((int32_t) (b.firstMs - to) > 0) return read;
+
+        size_t         len;
+        const uint8_t* recs = records(pos, b, len);
+        walk(recs, len, 0, inRange);
+        read++;
+    }
+    if ((more) && (openLen) && ((int32_t) (lastMs - from) >= 0) && ((int32_t) (openFirstMs - to) <= 0)) {
+        walk(open, openLen, 0, inRange);
+        read++;
+    }
+    return read;
+}
+
+uint32_t LogHistory::firstSeq() {
+    if ((kept) && (!kept->isEmpty())) return kept->firstSeq();
+    if (count) return block(valid(tail)).firstSeq;
+    return openRecords ? openFirst : 0;
+}
+
+/**
+ * The kept records are sparse, firstSeq() does not tell what was lost before them: the sequence numbers
+ * after since up to the newest record dropped from this ring are counted, less the ones the kept history holds.
+ */
+uint32_t LogHistory::lost(uint32_t since) {
+    if ((int32_t) (droppedSeq - since) <= 0) return 0;
+
+    uint32_t held = 0;
+    if (kept) kept->forEach(since, [&](const tHistoryRecord &record, const char *text) -> bool {
+        if ((int32_t) (record.seq - droppedSeq) > 0) return false;
+        held++;
+        return true;
+    });
+    return droppedSeq - since - held;
+}
+
+void LogHistory::printReport(Print& out) {
+    uint32_t raw = 0, stored = 0, records = 0;
+    uint16_t pos = tail;
+
+    for (uint16_t i=0; i<count; i++) {
+        pos = valid(pos);
+        tHistoryBlock b = block(pos);
+        raw     += b.raw;
+        stored  += sizeof(b) + b.length;
+        records += b.records;
+        pos     += sizeof(b) + b.length;
+    }
+
+    out.printf("History: %u records in %u sealed blocks, %u bytes stored for %u bytes of records%s\n",
+               (unsigned) records, (unsigned) count, (unsigned) stored, (unsigned) raw, compress ? " (compressed)" : "");
+    if (stored) out.printf("  %u records per KB\n", (unsigned) (records * 1024 / stored));
+    if (sealedRecords) out.printf("  compression %u %% of the records, %u cycles per record\n",
+                                  (unsigned) (storedBytes * 100 / rawBytes), (unsigned) (cycles / sealedRecords));
+    if (kept) {
+        out.printf("Kept from the dropped blocks, priority %u and higher: ", keptPri);
+        kept->printReport(out);
+    }
+}
@@ -0,0 +1,152 @@
+#ifndef LOG_HISTORY_H
+#define LOG_HISTORY_H
+
+#include <Arduino.h>
+#include <functional>
+#include "LogCompress.h"
+
+#define LOG_HISTORY_BLOCK     512     // open block, records are appended to it until it is sealed
+#define LOG_HISTORY_SUMMARY   32      // bytes of Bloom filter per block, over the words of its records
+#define LOG_HISTORY_WORDS     8       // most words in a find() query
+#define LOG_HISTORY_FILLER    0xFE    // pri of the room left by a record shorter than its reservation, or cancelled
+#define LOG_HISTORY_RESERVED  0xFF    // pri of a record being written
+#define LOG_HISTORY_COMPRESS_MIN 4096 // smaller, the scratch costs more than compression saves (tests/bench_history)
+
+/**
+ * Record header, followed by len bytes of text and pad bytes up to the next record
+ */
+typedef struct {
+    uint32_t    seq;                // Logger sequence number, shared by all sinks
+    uint32_t    ms;                 // millis() when logged, wall clock applied when rendered
+    uint16_t    len;
+    uint8_t     pri;
+    uint8_t     pad;
+} tHistoryRecord;
+
+// called for each record, oldest first, false stops the walk
+typedef std::function<bool(const tHistoryRecord &record, const char *text)> HistoryHandler;
+
+/**
+ * Words of a find() query, case insensitive
+ * A record matches when it holds all of them as whole words (letters, digits and '_')
+ */
+typedef struct {
+    const char* word[LOG_HISTORY_WORDS];
+    uint8_t     len[LOG_HISTORY_WORDS];
+    uint32_t    hash[LOG_HISTORY_WORDS];
+    uint8_t     count;
+} tHistoryQuery;
+
+/**
+ * History of the messages sent to WebSerial, kept in blocks of records
+ *
+ * Records are appended to the open block, which is sealed into a ring of sealed blocks when full.
+ * Each sealed block starts with a header, a header length of 0xFFFF marks the wrap to the beginning of the ring.
+ * With compression, sealed blocks are stored LZ compressed (see LogCompress.h) and only
+ * decompressed when they are read.
+ * When the ring is full, the oldest sealed blocks are dropped to make room.
+ * Each block carries a Bloom filter of the words of its records, find() only reads the blocks that may match.
+ * An index of the sealed block positions, oldest first, lets forRange() binary search the blocks by time.
+ * With a kept history (setKept), the important records of the dropped blocks are moved to it, so that a flood
+ * of debug lines does not wipe out the error before it. The kept records are older than the ones left here:
+ * reads go through the kept history first and the stream stays in order.
+ *
+ * A record can be written in place: reserve() gives room in the open block, commit() sets its header.
+ * Several writers, including interrupts, can hold disjoint reservations at the same time; the open block
+ * is only sealed when none is pending, outside of the critical sections. Readers skip the records not committed yet.
+ *
+ * Memory, given by the caller:
+ *   open block | scratch, with compression only | index | sealed blocks
+ * The scratch is the hash table while a block is compressed, straight into the ring, and a decompressed
+ * block while one is read: both never happen at the same time.
+ */
+class LogHistory {
+private:
+    typedef struct {
+        uint16_t    length;         // stored, header excluded
+        uint16_t    raw;            // before compression, length == raw when stored as is
+        uint16_t    records;
+        uint32_t    firstSeq;
+        uint32_t    lastSeq;
+        uint32_t    firstMs;
+        uint32_t    lastMs;
+        uint8_t     summary[LOG_HISTORY_SUMMARY];
+    } tHistoryBlock;
+
+    uint8_t*        open;
+    uint16_t        openLen;
+    uint16_t        openRecords;
+    uint8_t         pending;        // reservations not committed yet
+    volatile bool   sealing;        // the open block is being sealed, no reservation meanwhile
+    uint32_t        openFirst;
+    uint32_t        openFirstMs;
+    uint8_t         openSummary[LOG_HISTORY_SUMMARY];
+    uint8_t*        scratch;
+    uint16_t*       index;          // sealed block positions, circular, index[indexFirst] is the oldest block
+    uint16_t        indexSize;
+    uint16_t        indexFirst;
+    uint8_t*        data;
+    uint16_t        dataSize;
+    uint16_t        head;           // where the next sealed block goes
+    uint16_t        tail;           // oldest sealed block
+    uint16_t        count;
+    uint32_t        lastSeq;
+    uint32_t        lastMs;
+    uint32_t        droppedSeq;     // newest record dropped from the ring, kept or not
+    bool            compress;
+    LogHistory*     kept;           // gets the records of priority keptPri or higher of the dropped blocks
+    uint8_t         keptPri;
+
+    // statistics since begin()
+    uint32_t        rawBytes;
+    uint32_t        storedBytes;
+    uint32_t        sealedRecords;
+    uint32_t        cycles;         // spent compressing
+
+    uint16_t        ratio;          // stored bytes per 256 bytes of records of the last sealed block
+
+    void            seal();
+    uint16_t        vacate(size_t len);
+    bool            makeRoom(size_t len);
+    void            drop();
+    uint16_t        valid(uint16_t pos);
+    tHistoryBlock   block(uint16_t pos)   { tHistoryBlock b; memcpy(&b, data + pos, sizeof(b)); return b; };
+    uint16_t        blockAt(uint16_t i)   { return index[(indexFirst + i) % indexSize]; };    // i-th oldest sealed block
+    bool            walk(const uint8_t* records, size_t len, uint32_t since, HistoryHandler handler);
+    const uint8_t*  records(uint16_t pos, const tHistoryBlock& b, size_t& len);
+
+    static uint32_t wordHash(const char* word, size_t len);
+    static size_t   nextWord(const char* text, size_t len, size_t& pos);
+    static void     summarize(uint8_t* summary, const char* text, size_t len);
+    static bool     mayHold(const uint8_t* summary, const tHistoryQuery& query);
+    static bool     holds(const char* text, size_t len, const tHistoryQuery& query);
+
+public:
+                    LogHistory(void* memory, size_t size, bool compress);
+    static size_t   scratchSize(bool compress)   { return compress ? LOG_HISTORY_BLOCK : 0; };
+    static size_t   minSize(bool compress);     // memory holding one sealed block besides the open one
+    // part of size bytes for a kept history of percent, raised to its minimum, 0 when size cannot afford it
+    static size_t   keptSize(size_t size, uint8_t percent, bool compress);
+
+    // a record longer than a block is truncated, dropped when the block is full of pending reservations
+    void            add(uint32_t seq, uint32_t ms, uint8_t pri, const char* msg, size_t len);
+
+    // room for at least minLen and up to maxLen bytes of text, capacity set to what was given, NULL if none
+    char*           reserve(size_t minLen, size_t maxLen, size_t& capacity);
+    void            commit(char* text, uint32_t seq, uint32_t ms, uint8_t pri, size_t len);
+    void            cancel(char* text)    { commit(text, 0, 0, LOG_HISTORY_FILLER, 0); };
+    void            setKept(LogHistory* kept, uint8_t pri)   { this->kept = kept; keptPri = pri; };
+    bool            forEach(uint32_t since, HistoryHandler handler);       // records after since, oldest first, false if stopped
+    static uint8_t  parseQuery(const char* words, tHistoryQuery& query);    // words kept by pointer, returns their number
+    uint16_t        find(const tHistoryQuery& query, HistoryHandler handler);   // matching records, returns the blocks read
+    uint16_t        getBlocks()     { return count + (openLen ? 1 : 0) + (kept ? kept->getBlocks() : 0); };
+    uint16_t        forRange(uint32_t from, uint32_t to, HistoryHandler handler);  // records logged between millis() from and to, returns the blocks read
+    uint32_t        firstSeq();                                             // oldest record kept, 0 when empty
+    uint32_t        lost(uint32_t since);                                   // records after since dropped and not kept
+    uint32_t        getLastSeq()    { return lastSeq; };
+    void            clear();
+    bool            isEmpty()       { return (count == 0) && (openLen == 0) && ((!kept) || (kept->isEmpty())); };
+    void            printReport(Print& out);
+};
+
+#endif
@@ -0,0 +1,151 @@
+#include "LogNtp.h"
+#include "LogClock.h"
+
+#if defined(ESP8266)
+    #include <ESP8266WiFi.h>
+#elif defined(ESP32)
+    #include <WiFi.h>
+#endif
+#include <lwip/dns.h>
+
+#define NTP_PACKET_SIZE   48
+#define NTP_UNIX_EPOCH    2208988800UL    // seconds from 1900 to 1970
+
+static uint32_t readBE32(const uint8_t* p) {
+    return ((uint32_t) p[0] << 24) | ((uint32_t) p[1] << 16) | ((uint32_t) p[2] << 8) | p[3];
+}
+
+// called by lwIP once the server name is resolved or the query has failed
+struct LogNtpDns {
+    static void found(const char* name, const ip_addr_t* ip, void* arg) {
+        LogNtp* ntp = (LogNtp*) arg;
+        if (ip && IP_IS_V4(ip)) {
+            ntp->dnsIP    = ip_addr_get_ip4_u32(ip);
+            ntp->dnsState = LOG_NTP_DNS_FOUND;
+        }
+        else ntp->dnsState = LOG_NTP_DNS_FAILED;
+    }
+};
+
+LogNtp::LogNtp() {
+    udp        = NULL;
+    server     = NULL;
+    dnsState   = LOG_NTP_DNS_IDLE;
+    dnsIP      = 0;
+    timeOffset = 0;
+    interval   = 0;
+    retry      = LOG_NTP_RETRY;
+    nextTry    = 0;
+    sentAt     = 0;
+    waiting    = false;
+    syncs      = 0;
+    lastStep   = 0;
+}
+
+void LogNtp::begin(UDP* udp, const char* server, long timeOffset, uint32_t interval) {
+    this->udp        = udp;
+    this->server     = server;
+    this->timeOffset = timeOffset;
+    this->interval   = interval ? interval : 60000;
+    serverIP         = IPAddress(0,0,0,0);
+    nextTry          = millis();
+    udp->begin(LOG_NTP_LOCAL_PORT);
+}
+
+bool LogNtp::handle() {
+    if (!udp) return false;
+    uint32_t now = millis();
+
+    if (waiting) {
+        if (receive(now)) {
+            waiting = false;
+            retry   = LOG_NTP_RETRY;
+            nextTry = now + interval;
+            return true;
+        }
+        if (now - sentAt < LOG_NTP_TIMEOUT) return false;
+
+        // no answer, try again later
+        waiting = false;
+        later(now);
+        return false;
+    }
+
+    if (((int32_t) (now - nextTry) >= 0) && (WiFi.status() == WL_CONNECTED)) request(now);
+    return false;
+}
+
+/* Try again later and less and less often */
+void LogNtp::later(uint32_t now) {
+    nextTry = now + retry;
+    retry   = std::min(retry * 2, interval);
+}
+
+/* True once serverIP is known, otherwise the DNS query is sent or still running and handle() comes back */
+bool LogNtp::resolve(uint32_t now) {
+    if (serverIP.fromString(server)) return true;
+
+    switch (dnsState) {
+    case LOG_NTP_DNS_PENDING:
+        return false;
+    case LOG_NTP_DNS_FOUND:
+        serverIP = IPAddress((uint32_t) dnsIP);
+        dnsState = LOG_NTP_DNS_IDLE;
+        return true;
+    case LOG_NTP_DNS_FAILED:
+        dnsState = LOG_NTP_DNS_IDLE;
+        later(now);
+        return false;
+    }
+
+    // answered from the lwIP cache, or asked to the DNS server without waiting
+    ip_addr_t ip;
+    dnsState = LOG_NTP_DNS_PENDING;
+    err_t err = dns_gethostbyname(server, &ip, LogNtpDns::found, this);
+    if (err == ERR_INPROGRESS) return false;
+    dnsState = LOG_NTP_DNS_IDLE;
+    if ((err == ERR_OK) && IP_IS_V4(&ip)) {
+        serverIP = IPAddress(ip_addr_get_ip4_u32(&ip));
+        return true;
+    }
+    later(now);
+    return false;
+}
+
+void LogNtp::request(uint32_t now) {
+    if (((uint32_t) serverIP == 0) && (!resolve(now))) return;
+
+    // client mode, version 4, everything else left to 0
+    uint8_t packet[NTP_PACKET_SIZE];
+    memset(packet, 0, sizeof(packet));
+    packet[0] = 0b11100011;
+
+    while (udp->parsePacket() > 0) udp->flush();      // late answer to a previous request
+    udp->beginPacket(serverIP, LOG_NTP_PORT);
+    udp->write(packet, sizeof(packet));
+    udp->endPacket();
+    sentAt  = now;
+    waiting = true;
+}
+
+/* The transmit time of the server, plus half the round trip, was the wall clock at now */
+bool LogNtp::receive(uint32_t now) {
+    int size = udp->parsePacket();
+    if (size <= 0) return false;
+    if (size < NTP_PACKET_SIZE) {
+        udp->flush();
+        return false;
+    }
+
+    uint8_t packet[NTP_PACKET_SIZE];
+    udp->read(packet, sizeof(packet));
+    udp->flush();
+    if (((packet[0] & 7) != 4) || (packet[1] == 0)) return false;   // not a server answer, or kiss-o'-death
+
+    uint32_t seconds = readBE32(packet + 40);
+    uint32_t milli   = ((uint64_t) readBE32(packet + 44) * 1000) >> 32;
+
+    lastStep = LogTime.setTime(seconds - NTP_UNIX_EPOCH + timeOffset, milli + (now - sentAt) / 2, now);
+    syncs++;
+    return true;
+}
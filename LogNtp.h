@@ -0,0 +1,58 @@
+#ifndef LOG_NTP_H
+#define LOG_NTP_H
+
+#include <Arduino.h>
+#include <Udp.h>
+
+#define LOG_NTP_PORT          123
+#define LOG_NTP_LOCAL_PORT    1337      // same as NTPClient
+#define LOG_NTP_TIMEOUT       1000      // ms waiting for an answer
+#define LOG_NTP_RETRY         2000      // ms before a new request after a failure, doubled up to the update interval
+
+#define LOG_NTP_DNS_IDLE      0
+#define LOG_NTP_DNS_PENDING   1         // query sent, lwIP calls back with the address or a failure
+#define LOG_NTP_DNS_FOUND     2
+#define LOG_NTP_DNS_FAILED    3
+
+/**
+ * SNTP client that never waits for the network
+ * handle() sends a request when a sync is due and picks the answer up on a later call,
+ * the wall clock offset of millis() is then set in LogTime.
+ * Records keep their millis() and get their time when rendered, so messages logged before the
+ * first sync show the right time afterwards, and drift is corrected on each sync.
+ * The server name is resolved once, when the network is up, by an asynchronous DNS query
+ * whose answer is also picked up on a later call.
+ */
+class LogNtp {
+private:
+    UDP*        udp;
+    const char* server;
+    IPAddress   serverIP;
+    volatile uint8_t  dnsState;         // LOG_NTP_DNS_xxx, set by the lwIP callback
+    volatile uint32_t dnsIP;
+    long        timeOffset;             // seconds added to UTC
+    uint32_t    interval;               // ms between syncs
+    uint32_t    retry;                  // current delay after a failure
+    uint32_t    nextTry;                // millis() of the next request
+    uint32_t    sentAt;                 // millis() of the request waiting for its answer
+    bool        waiting;
+    uint32_t    syncs;
+    int32_t     lastStep;               // ms the clock moved at the last sync
+
+    void        later(uint32_t now);
+    bool        resolve(uint32_t now);
+    void        request(uint32_t now);
+    bool        receive(uint32_t now);
+
+    friend struct LogNtpDns;
+
+public:
+                LogNtp();
+    void        begin(UDP* udp, const char* server, long timeOffset, uint32_t interval);
+    bool        handle();               // true when the clock has just been set
+    bool        isSynced()      { return syncs != 0; };
+    uint32_t    getSyncs()      { return syncs; };
+    int32_t     getLastStep()   { return lastStep; };
+};
+
+#endif
@@ -0,0 +1,82 @@
+#include "LogRateLimit.h"
+
+LogRateLimit::LogRateLimit() {
+    memset(sites, 0, sizeof(sites));
+    memset(limits, 0, sizeof(limits));
+    evicted    = 0;
+    evictedPri = 7;
+}
+
+void LogRateLimit::setLimit(uint8_t pri, uint16_t rate, uint16_t burst) {
+    if (pri > 7) return;
+    limits[pri].rate  = rate;
+    limits[pri].burst = burst ? burst : rate;
+}
+
+bool LogRateLimit::allow(const void* site, uint8_t pri, uint32_t now) {
+    tLogLimit &limit = limits[pri & 7];
+    if (limit.rate == 0) return true;
+
+    // a few slots probed from the hash of the address, the least recently refilled one is reused,
+    // preferably one without suppressed messages
+    uint8_t   base   = ((uintptr_t) site >> 2) & (LOG_LIMIT_SITES - 1);
+    tLogSite *entry  = NULL;
+    tLogSite *oldest = NULL;
+    for (uint8_t i=0; i<LOG_LIMIT_WAYS; i++) {
+        tLogSite *s = &sites[(base + i) & (LOG_LIMIT_SITES - 1)];
+        if (s->site == site) {
+            entry = s;
+            break;
+        }
+        if      ((!oldest) || (!s->site)) oldest = (oldest && !oldest->site) ? oldest : s;
+        else if (!oldest->site) continue;
+        else if ((!s->suppressed) && (oldest->suppressed)) oldest = s;
+        else if ((!s->suppressed == !oldest->suppressed) && ((int32_t) (s->last - oldest->last) < 0)) oldest = s;
+    }
+    if (!entry) {
+        // the count of the call site losing its slot is reported by expired()
+        if ((oldest->site) && (oldest->suppressed)) {
+            evicted    = (evicted > 0xFFFF - oldest->suppressed) ? 0xFFFF : evicted + oldest->suppressed;
+            evictedPri = std::min(evictedPri, oldest->pri);
+        }
+        entry             = oldest;
+        entry->site       = site;
+        entry->last       = now;
+        entry->tokens     = limit.burst * 1000;
+        entry->suppressed = 0;
+    }
+    entry->pri = pri;
+
+    // refill: rate messages per second is rate / 1000 of a message per ms, 64 bits for a long quiet time
+    uint64_t tokens = entry->tokens + (uint64_t) (now - entry->last) * limit.rate;
+    entry->last   = now;
+    entry->tokens = std::min(tokens, (uint64_t) limit.burst * 1000);
+
+    if (entry->tokens < 1000) {
+        if (!entry->suppressed) entry->since = now;
+        if (entry->suppressed < 0xFFFF) entry->suppressed++;
+        return false;
+    }
+    entry->tokens -= 1000;
+    return true;
+}
+
+bool LogRateLimit::expired(uint32_t now, uint8_t &pri, uint16_t &suppressed) {
+    if (evicted) {
+        pri        = evictedPri;
+        suppressed = evicted;
+        evicted    = 0;
+        evictedPri = 7;
+        return true;
+    }
+
+    for (uint8_t i=0; i<LOG_LIMIT_SITES; i++) {
+        tLogSite &s = sites[i];
+        if ((!s.suppressed) || (now - s.since < LOG_LIMIT_SUMMARY)) continue;
+        pri          = s.pri;
+        suppressed   = s.suppressed;
+        s.suppressed = 0;
+        return true;
+    }
+    return false;
+}
@@ -0,0 +1,50 @@
+#ifndef LOG_RATE_LIMIT_H
+#define LOG_RATE_LIMIT_H
+
+#include <Arduino.h>
+
+#define LOG_LIMIT_SITES       32      // call sites tracked, power of 2
+#define LOG_LIMIT_WAYS        4       // slots probed for a call site
+#define LOG_LIMIT_SUMMARY     5000    // ms between two summaries of a call site
+
+/**
+ * Token bucket rate limiting per call site
+ * A call site is identified by its format string (or event name) address, which is unique per log statement.
+ * No priority is limited until setLimit() is called.
+ * There is no lock: the buckets are plain counters, a message logged from an interrupt
+ * in the middle of an update can at worst make one count slightly off.
+ */
+class LogRateLimit {
+private:
+    typedef struct {
+        const void* site;
+        uint32_t    last;           // millis() of the last refill
+        uint32_t    tokens;         // in 1/1000 of a message
+        uint32_t    since;          // millis() of the first message dropped since the last summary
+        uint16_t    suppressed;     // messages dropped since the last summary
+        uint8_t     pri;
+    } tLogSite;
+
+    typedef struct {
+        uint16_t    rate;           // messages per second, 0 = unlimited
+        uint16_t    burst;
+    } tLogLimit;
+
+    tLogSite    sites[LOG_LIMIT_SITES];
+    tLogLimit   limits[8];
+    uint16_t    evicted;            // dropped messages of the call sites whose slot was reused
+    uint8_t     evictedPri;         // highest priority among them
+
+public:
+                LogRateLimit();
+    void        setLimit(uint8_t pri, uint16_t rate, uint16_t burst);
+
+    // true when the message may go out, the dropped ones are counted for expired()
+    bool        allow(const void* site, uint8_t pri, uint32_t now);
+
+    // a summary due: messages of a reused slot at once, those of a call site LOG_LIMIT_SUMMARY ms
+    // after the first of them, so a flooding call site gets one summary per interval, true until there is none left
+    bool        expired(uint32_t now, uint8_t &pri, uint16_t &suppressed);
+};
+
+#endif
@@ -0,0 +1,90 @@
+#include "LogSerial.h"
+#include "LogFormat.h"
+
+LogSerial::LogSerial(HardwareSerial& port) {
+    this->port = &port;
+    ring       = NULL;
+    size       = 0;
+    head       = 0;
+    tail       = 0;
+    policy     = LOG_SERIAL_DROP;
+    framed     = false;
+    overruns   = 0;
+    pending    = 0;
+}
+
+void LogSerial::begin(void* memory, uint16_t size) {
+    ring       = (uint8_t*) memory;
+    this->size = ring ? size : 0;
+    head       = 0;
+    tail       = 0;
+}
+
+void LogSerial::put(const char* data, size_t len) {
+    while (len) {
+        size_t n = std::min(len, (size_t) (size - head));
+        memcpy(ring + head, data, n);
+        head  = (head + n == size) ? 0 : head + n;
+        data += n;
+        len  -= n;
+    }
+}
+
+bool LogSerial::write(const char* prefix, size_t plen, const char* msg, size_t len) {
+    if ((!ring) || (policy == LOG_SERIAL_BLOCK)) {
+        drain();
+        if (ring) while (used()) { port->flush(); drain(); }      // keep the order of the ring
+        if (plen) port->write((const uint8_t*) prefix, plen);
+        port->write((const uint8_t*) msg, len);
+        return true;
+    }
+
+    drain();
+
+    // tell how many messages were lost, once there is room again
+    if ((pending) && (!framed)) {
+        char      note[40];
+        LogWriter w(note, sizeof(note));
+        w.str("Serial: ").u32(pending).str(" messages dropped\n");
+        if (w.length() + plen + len > room()) {
+            pending++;
+            overruns++;
+            return false;
+        }
+        put(note, w.length());
+        pending = 0;
+    }
+
+    if (plen + len > room()) {
+        overruns++;
+        if ((policy == LOG_SERIAL_DROP) || (framed) || (room() < plen + 2)) {
+            if (!framed) pending++;
+            return false;
+        }
+        // truncated, marked with "~\n"
+        len = room() - plen - 2;
+        put(prefix, plen);
+        put(msg, len);
+        put("~\n", 2);
+    } else {
+        put(prefix, plen);
+        put(msg, len);
+    }
+
+    drain();
+    return true;
+}
+
+/* Move what the UART FIFO can take without waiting */
+void LogSerial::drain() {
+    if (!ring) return;
+
+    int free = port->availableForWrite();
+    while ((free > 0) && (head != tail)) {
+        size_t n = (head > tail) ? head - tail : size - tail;
+        if (n > (size_t) free) n = free;
+        port->write(ring + tail, n);
+        tail  = (tail + n == size) ? 0 : tail + n;
+        free -= n;
+    }
+}
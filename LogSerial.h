@@ -0,0 +1,47 @@
+#ifndef LOG_SERIAL_H
+#define LOG_SERIAL_H
+
+#include <Arduino.h>
+
+#define LOG_SERIAL_RING       1024    // default TX ring, bytes
+
+// what happens to a message that does not fit in the TX ring
+#define LOG_SERIAL_DROP       0       // the whole message is dropped
+#define LOG_SERIAL_TRUNCATE   1       // what fits is kept, ending with "~\n"
+#define LOG_SERIAL_BLOCK      2       // wait for the UART, as Serial.write does
+
+/**
+ * Serial sink that never waits for the UART
+ * Messages are copied into a TX ring, drained into the UART FIFO as far as availableForWrite() allows,
+ * on each write and from Logger::handle().
+ * Until begin() gives it a ring, it writes to Serial directly.
+ */
+class LogSerial {
+private:
+    HardwareSerial* port;
+    uint8_t*        ring;
+    uint16_t        size;
+    uint16_t        head;           // next byte written
+    uint16_t        tail;           // next byte sent
+    uint8_t         policy;
+    bool            framed;         // binary records: no note, no truncation
+    uint32_t        overruns;       // messages dropped or truncated
+    uint16_t        pending;        // dropped since the last message that went through
+
+    uint16_t        used()  { return (head >= tail) ? head - tail : size - tail + head; };
+    uint16_t        room()  { return size - 1 - used(); };
+    void            put(const char* data, size_t len);
+
+public:
+                    LogSerial(HardwareSerial& port = Serial);
+    void            begin(void* memory, uint16_t size);
+    void            setPolicy(uint8_t policy)   { this->policy = policy; };
+    void            setFramed(bool framed)      { this->framed = framed; };
+    uint32_t        getOverruns()               { return overruns; };
+
+    // prefix and message go out together or not at all (LOG_SERIAL_DROP), false when dropped
+    bool            write(const char* prefix, size_t plen, const char* msg, size_t len);
+    void            drain();
+};
+
+#endif
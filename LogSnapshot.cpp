@@ -0,0 +1,129 @@
+#include "LogSnapshot.h"
+#include "LogClock.h"
+
+LogSnapshot::LogSnapshot() {
+    enabled    = false;
+    mounted    = false;
+    slots      = LOG_SNAPSHOT_SLOTS;
+    after      = LOG_SNAPSHOT_AFTER;
+    interval   = LOG_SNAPSHOT_INTERVAL;
+    pending    = false;
+    triggerSeq = 0;
+    triggerMs  = 0;
+    saved      = false;
+    savedMs    = 0;
+    number     = 0;
+    skipped    = 0;
+}
+
+void LogSnapshot::begin(uint8_t slots, uint16_t after, uint32_t interval) {
+    this->slots    = slots ? slots : 1;
+    this->after    = after;
+    this->interval = interval;
+    enabled        = true;
+}
+
+void LogSnapshot::path(char* out, size_t size, uint32_t n) {
+    snprintf(out, size, LOG_SNAPSHOT_DIR "/snap%u.log", (unsigned) n);
+}
+
+/* Mounted when first needed, the last snapshot number is found in the directory */
+bool LogSnapshot::mount() {
+    if (mounted) return true;
+    if (!LittleFS.begin()) {
+        enabled = false;
+        return false;
+    }
+    mounted = true;
+
+    LittleFS.mkdir(LOG_SNAPSHOT_DIR);
+    Dir dir = LittleFS.openDir(LOG_SNAPSHOT_DIR);
+    while (dir.next()) {
+        uint32_t n = strtoul(dir.fileName().c_str() + 4, NULL, 10);     // "snap<n>.log"
+        if (n > number) number = n;
+    }
+    return true;
+}
+
+/* From the logging call: no flash access here */
+void LogSnapshot::trigger(uint32_t seq, uint32_t ms) {
+    if ((!enabled) || (pending)) return;
+    if ((saved) && (ms - savedMs < interval)) {
+        skipped++;
+        return;
+    }
+    pending    = true;
+    triggerSeq = seq;
+    triggerMs  = ms;
+}
+
+bool LogSnapshot::isDue(uint32_t seq, uint32_t ms) {
+    return (pending) && (((int32_t) (seq - triggerSeq) >= after) || (ms - triggerMs >= LOG_SNAPSHOT_WAIT));
+}
+
+/* Whole history up to the records following the trigger, the oldest snapshot file is replaced */
+bool LogSnapshot::save(LogHistory* history) {
+    pending = false;
+    saved   = true;
+    savedMs = millis();
+    if ((!history) || (!mount())) return false;
+
+    char name[32];
+    if (number >= slots) {
+        path(name, sizeof(name), number + 1 - slots);
+        LittleFS.remove(name);
+    }
+    path(name, sizeof(name), ++number);
+    File file = LittleFS.open(name, "w");
+    if (!file) return false;
+
+    file.printf("Snapshot %u, record %u at %s", (unsigned) number, (unsigned) triggerSeq, LogTime.getPrefix(triggerMs));
+    file.printf("%u earlier triggers skipped\n", (unsigned) skipped);
+    skipped = 0;
+
+    uint32_t last = triggerSeq + after;
+    history->forEach(0, [&](const tHistoryRecord &record, const char *text) -> bool {
+        if ((int32_t) (record.seq - last) > 0) return false;
+        file.printf("<%u>", record.pri);
+        file.write((const uint8_t*) LogTime.getPrefix(record.ms), LOG_PREFIX_SIZE - 1);
+        file.write((const uint8_t*) text, record.len);
+        return true;
+    });
+    file.close();
+    return true;
+}
+
+/* [{"n":3,"size":5120},...] */
+void LogSnapshot::printList(Print& out) {
+    bool first = true;
+
+    out.print("[");
+    if (mount()) {
+        Dir dir = LittleFS.openDir(LOG_SNAPSHOT_DIR);
+        while (dir.next()) {
+            out.printf("%s{\"n\":%u,\"size\":%u}", first ? "" : ",", (unsigned) strtoul(dir.fileName().c_str() + 4, NULL, 10), (unsigned) dir.fileSize());
+            first = false;
+        }
+    }
+    out.print("]");
+}
+
+/* <url>/snapshots lists them, <url>/snapshot?n=3 downloads one */
+void LogSnapshot::serve(AsyncWebServer* server, const char* url) {
+    char route[48];
+
+    snprintf(route, sizeof(route), "%s/snapshots", url);
+    server->on(route, HTTP_GET, [this](AsyncWebServerRequest *request){
+        AsyncResponseStream *response = request->beginResponseStream("application/json");
+        printList(*response);
+        request->send(response);
+    });
+
+    snprintf(route, sizeof(route), "%s/snapshot", url);
+    server->on(route, HTTP_GET, [this](AsyncWebServerRequest *request){
+        char name[32];
+        path(name, sizeof(name), request->hasParam("n") ? strtoul(request->getParam("n")->value().c_str(), NULL, 10) : number);
+        if ((!mount()) || (!LittleFS.exists(name))) request->send(404, "text/plain", "No such snapshot");
+        else request->send(LittleFS, name, "text/plain", true);
+    });
+}
@@ -0,0 +1,53 @@
+#ifndef LOG_SNAPSHOT_H
+#define LOG_SNAPSHOT_H
+
+#include <Arduino.h>
+#include <LittleFS.h>
+#include <ESPAsyncWebServer.h>
+#include "LogHistory.h"
+
+#define LOG_SNAPSHOT_DIR      "/snapshots"
+#define LOG_SNAPSHOT_SLOTS    4         // files kept, the oldest is replaced
+#define LOG_SNAPSHOT_AFTER    20        // records after the trigger in the snapshot
+#define LOG_SNAPSHOT_WAIT     5000      // ms at most waiting for them
+#define LOG_SNAPSHOT_INTERVAL 600000    // ms between two snapshots, flash wear
+
+/**
+ * Flight recorder: the history around a LOG_CRIT or higher message saved to LittleFS
+ * trigger() only takes note, the file is written by save() from Logger::handle() once
+ * the next records are in the history or after LOG_SNAPSHOT_WAIT.
+ * A trigger within the interval of the last snapshot is only counted.
+ * Files are /snapshots/snap<n>.log, one "<pri>hh:mm:ss.mmm - text" line per record.
+ */
+class LogSnapshot {
+private:
+    bool        enabled;
+    bool        mounted;
+    uint8_t     slots;
+    uint16_t    after;
+    uint32_t    interval;
+
+    bool        pending;
+    uint32_t    triggerSeq;
+    uint32_t    triggerMs;
+    bool        saved;                  // at least one snapshot since the boot
+    uint32_t    savedMs;
+    uint32_t    number;                 // of the last snapshot file, 0 when none
+    uint16_t    skipped;                // triggers within the interval
+
+    bool        mount();
+    static void path(char* out, size_t size, uint32_t n);
+
+public:
+                LogSnapshot();
+    void        begin(uint8_t slots, uint16_t after, uint32_t interval);
+    bool        isEnabled()     { return enabled; };
+
+    void        trigger(uint32_t seq, uint32_t ms);
+    bool        isDue(uint32_t seq, uint32_t ms);
+    bool        save(LogHistory* history);
+    void        printList(Print& out);      // JSON
+    void        serve(AsyncWebServer* server, const char* url);
+};
+
+#endif
@@ -29,11 +29,38 @@
 #include <ESPAsyncWebServer.h>
 #include "WebSerialSM.h"
 
-// ********************************************************************
-// for NTP client
-#include <NTPClient.h>
-
-
+#include "LogArena.h"
+#include "LogClock.h"
+#include "LogFormat.h"
+#include "LogEvent.h"
+#include "LogRateLimit.h"
+#include "LogSerial.h"
+#include "LogBinary.h"
+#include "LogNtp.h"
+#include "LogBoot.h"
+#include "LogSnapshot.h"
+
+#define LOG_HISTORY_SIZE      (4*1024)    // WebSerial history, bytes
+#define LOG_HISTORY_MSG       200         // WebSerial history, messages
+#define LOG_EARLY_SIZE        128         // printf buffer before begin()
+#define LOG_MODULES           16          // module tags, module 0 is the default one
+#define LOG_REPEAT_TIMEOUT    30000       // ms, "repeated N times" line sent by handle() at the latest
+#define LOG_RESERVE_MIN       128         // history room needed to format a message in place, else it is copied
+
+// sinks, for setFormat()
+#define LOG_SINK_SERIAL       0
+#define LOG_SINK_WEB          1
+#define LOG_SINK_SYSLOG       2
+#define LOG_SINKS             3
+
+
+/**
+ * Module tag of a log statement, returned by Logger::registerModule()
+ * A distinct type so that Log.printf(module, pri, ...) cannot be taken for Log.printf(pri, fmt, ...)
+ */
+typedef struct {
+  uint8_t   id;
+} LogModule;
 
 typedef struct {
   IPAddress serverIP;
@@ -47,6 +74,8 @@ typedef struct {
   char            path[30];
   RecvMsgHandler  cbMsgHandler;
   void*           cbContext;
+  short           historySize;
+  short           historyMsg;
 } tWebSerialParam;
 
 typedef struct {
@@ -67,30 +96,127 @@ private:
   WiFiUDP         *udpClient;
   Syslog          *syslog;
   AsyncWebServer  *serverWeb;
-  NTPClient       *timeClient;
+  LogNtp          ntp;                  // synced from handle(), never waits for the network
+  LogBoot         boot;                 // messages logged before their sinks exist, boot phase times
+  LogSnapshot     snapshot;             // history saved to flash after a LOG_CRIT or higher message
+  bool            started;              // begin() done: Serial and the history are up
+  bool            online;               // network sinks created
 
 
   char            *buffer;
   uint16_t        bufferSize;
+
+  LogArena        arena;
+  size_t          budget;
   
   uint32_t        serialSpeed;
+  bool            serialTime;
+  uint16_t        serialRing;
+  LogSerial       serialSink;
+  LogBinary       binaryLog;            // setFormat(LOG_SINK_SERIAL, LOG_FORMAT_BINARY)
+  uint32_t        seq;                  // last record, numbers shared by all sinks
+
+  uint8_t         format[LOG_SINKS];    // LOG_FORMAT_xxx of LogEvent per sink
+  LogRateLimit    limiter;
+
+  // highest priority logged per module, checked before any formatting
+  uint8_t         levels[LOG_MODULES];
+  const char*     modules[LOG_MODULES];
+  uint8_t         nbModules;
+
+  // identical consecutive messages are collapsed, only a hash of the last one is kept
+  uint32_t        lastHash;
+  uint16_t        lastLen;
+  uint8_t         lastPri;
+  uint16_t        repeatCount;
+  uint32_t        repeatSince;
 
   static void cbWebSerialConnect(void *context, bool isConnected);
   static void cbWebSerialMsg(void *context, char *msg);
+  static uint32_t cbWebSerialSeq(void *context) { return static_cast<Logger*>(context)->nextSeq(); };
+
+  friend class LogEvent;
+  void emit(const LogEvent& event);
+  // formats the text of a message into buf, returns its length, size or more when truncated, as vsnprintf
+  typedef int (*tLogFormat)(char *buf, size_t size, const char *fmt, void *args);
+  bool admit(uint8_t pri, const char *fmt);
+  void log(uint8_t pri, const char *fmt, va_list argp);
+  void log(uint8_t pri, const char *fmt, const LogArg *list, uint8_t count);
+  void compose(uint8_t pri, const char *fmt, tLogFormat formatter, void *args, uint32_t id, bool serial);
+  void dump(uint8_t pri, const void *data, size_t len);
+  void sendModules();
+  void output(uint8_t pri, const char *buf, size_t len, uint32_t id, bool serial = true, char *slot = NULL);
+  void serialWrite(uint8_t pri, const char *buf, size_t len, uint32_t id);
+  void outputSuppressed(uint8_t pri, uint16_t suppressed);
+  bool repeated(uint8_t pri, const char *buf, size_t len);
+  void flushRepeated();
+  void clockSet();
+  void startNetwork();
+  size_t networkFootprint();
+  // on top of the module levels, the web page only gets LOG_NOTICE and higher, LOG_INFO too with its Debug button on
+  bool toWeb(uint8_t pri)    { return (started) && (webSerialParam.port) && (pri <= (WebSerial.getDebug() ? LOG_INFO : LOG_NOTICE)); };
+  bool toSyslog(uint8_t pri) { return (syslog) && (pri<=LOG_NOTICE); };
+  // kept for the sinks not there yet: all of them before begin(), then syslog until the network is up
+  bool toBoot(uint8_t pri)   { return (!started) || ((syslogParam.port) && (!syslog) && (pri<=LOG_NOTICE)); };
    
 public:
   Logger (uint32_t serialSpeed, uint16_t bufferSize);
   void initSyslog(char *deviceName, char *appName, IPAddress serverIP = IPAddress(192,168,0,7), uint16_t port = 514);
   void initWebSerial(RecvMsgHandler  cbMsgHandler, void* context, char *path="/log", uint16_t port = 80);
-  void initSerial(uint32_t serialSpeed);
+  void initSerial(uint32_t serialSpeed, bool timePrefix = false, uint16_t ringSize = LOG_SERIAL_RING, uint8_t policy = LOG_SERIAL_DROP);
   void initNTP(const char* poolServerName="europe.pool.ntp.org", long timeOffset=3600, unsigned long updateInterval=60000);
+  void initSnapshot(uint8_t slots = LOG_SNAPSHOT_SLOTS, uint16_t after = LOG_SNAPSHOT_AFTER, uint32_t interval = LOG_SNAPSHOT_INTERVAL);
+  void setBudget(size_t budget);      // whole logger memory, 0 = just what the configuration needs
+  size_t getBudget();
+  void printBudget(Print& out = Serial);
+  void printBootReport(Print& out = Serial) { boot.printReport(out); };
+  void setHistoryCompression(bool compress) { WebSerial.setCompression(compress); };
+  void setHistoryRetention(uint8_t pri, uint8_t percent) { WebSerial.setRetention(pri, percent); };    // before begin()
+  uint32_t getSerialOverruns() { return serialSink.getOverruns(); };
   
-  void begin();
+  void begin();                       // Serial and the history, the network sinks are started once WiFi is up
+  void handle();                      // from loop()
+  uint32_t nextSeq() { return ++seq; };
 
   void printf(uint8_t pri, char *fmt, ...);
+  void printf(LogModule module, uint8_t pri, char *fmt, ...);
+
+  // printf without vsnprintf, the conversions are picked from the argument types, see LogFormat.h
+  // LOG_PRINT(LOG_INFO, "rssi %d\n", WiFi.RSSI()) also checks the format at compile time
+  template<typename... A> void print(uint8_t pri, const char *fmt, const A&... args) {
+    if (pri > levels[0]) return;
+    LogArg list[] = { LogArg(args)..., LogArg() };
+    log(pri, fmt, list, sizeof...(A));
+  };
+  template<typename... A> void print(LogModule module, uint8_t pri, const char *fmt, const A&... args) {
+    if (pri > levels[module.id]) return;
+    LogArg list[] = { LogArg(args)..., LogArg() };
+    log(pri, fmt, list, sizeof...(A));
+  };
+
+  // rows of 16 bytes in hexadecimal and ASCII, one message each
+  void hexdump(uint8_t pri, const void *data, size_t len) { if (pri <= levels[0]) dump(pri, data, len); };
+  void hexdump(LogModule module, uint8_t pri, const void *data, size_t len) { if (isEnabled(module, pri)) dump(pri, data, len); };
+
+  // per module levels, e.g. LogModule WIFI = Log.registerModule("wifi", LOG_NOTICE);
+  LogModule registerModule(const char* name, uint8_t level = LOG_DEBUG);
+  void setLevel(LogModule module, uint8_t level);
+  bool setLevel(const char* name, uint8_t level);
+  bool isEnabled(LogModule module, uint8_t pri) { return pri <= levels[module.id]; };
+
+  // structured logging, see LogEvent.h: Log.event(LOG_INFO, "motor").kv("rpm", 1200).kv("temp", 41.5);
+  LogEvent event(uint8_t pri, const char* name) { return LogEvent((pri <= levels[0]) ? this : NULL, pri, name); };
+  LogEvent event(LogModule module, uint8_t pri, const char* name) { return LogEvent(isEnabled(module, pri) ? this : NULL, pri, name); };
+  void setFormat(uint8_t sink, uint8_t format);
+
+  // messages per second and burst allowed per log statement for a priority, rate 0 = unlimited (the default)
+  void setRateLimit(uint8_t pri, uint16_t rate, uint16_t burst = 0);
 
 };
 
 extern Logger Log;
 
+#define LOG_PRINT(pri, fmt, ...)                 do { LOG_FORMAT_CHECK(fmt, ##__VA_ARGS__); Log.print(pri, fmt, ##__VA_ARGS__); } while (0)
+#define LOG_MODULE_PRINT(module, pri, fmt, ...)  do { LOG_FORMAT_CHECK(fmt, ##__VA_ARGS__); Log.print(module, pri, fmt, ##__VA_ARGS__); } while (0)
+
 #endif 
@@ -1,5 +1,6 @@
 #include "Logger.h"
 #include "EspSaveCrashND.h"
+#include "LogFormat.h"
 
 Logger  Log(115200, 1024);
 
@@ -10,11 +11,25 @@ EspSaveCrash SaveCrash(0x0020, 0x0200);
 void Logger::cbWebSerialConnect(void *context, bool isConnected){
   Logger* plog = static_cast<Logger*>(context);
   Serial.printf("Connection :%d\n", isConnected); 
+  if (isConnected) plog->sendModules();
 }
 
 /* Message callback of WebSerial */
 void Logger::cbWebSerialMsg(void *context, char *msg){
   Logger* plog = static_cast<Logger*>(context);  
+
+  // "#Level <module> <level>#" from the web page
+  if (strncmp(msg, "#Level ", 7) == 0) {
+    char *level = strrchr(msg, ' ');
+    if ((level) && (level > msg + 6)) {
+      *level = 0;
+      if (plog->setLevel(msg + 7, atoi(level + 1))) WebSerial.printf((char*) "Level of %s = %d\n", msg + 7, atoi(level + 1));
+      else                                          WebSerial.printf((char*) "Unknown module %s\n", msg + 7);
+    }
+    plog->sendModules();
+    return;
+  }
+
   Log.printf(LOG_NOTICE, "WMSG - Recieved %s [%p]\n",msg, plog->webSerialParam.cbContext);
   if (plog->webSerialParam.cbMsgHandler) plog->webSerialParam.cbMsgHandler(plog->webSerialParam.cbContext, msg); 
 }
@@ -25,9 +40,30 @@ Logger::Logger(uint32_t serialSpeed, uint16_t bufferSize) {
 
   this->bufferSize = bufferSize;
   this->serialSpeed = serialSpeed;
+  this->serialTime  = false;
+  this->serialRing  = LOG_SERIAL_RING;
+  seq = 0;
+  binaryLog.begin(&serialSink);
+  for (uint8_t i=0; i<LOG_SINKS; i++) format[i] = LOG_FORMAT_TEXT;
   
-  Serial.begin(serialSpeed);
-  buffer = (char*) malloc(bufferSize);
+  buffer  = NULL;         // carved from the arena by begin(), Serial started there too
+  started = false;
+  online  = false;
+  budget = 0;
+
+  levels[0]   = LOG_DEBUG;
+  modules[0]  = "main";
+  nbModules   = 1;
+
+  lastHash    = 0;
+  lastLen     = 0;
+  lastPri     = 0;
+  repeatCount = 0;
+  repeatSince = 0;
+
+  udpClient  = NULL;
+  syslog     = NULL;
+  serverWeb  = NULL;
 
   syslogParam.serverIP   = IPAddress(0,0,0,0);
   syslogParam.port       = 0;
@@ -41,6 +77,8 @@ Logger::Logger(uint32_t serialSpeed, uint16_t bufferSize) {
   webSerialParam.cbMsgHandler = NULL;
   webSerialParam.cbContext    = NULL;
   webSerialParam.port         = 0;
+  webSerialParam.historySize  = 0;
+  webSerialParam.historyMsg   = 0;
   strcpy(webSerialParam.path,"");
   
 }
@@ -58,11 +96,20 @@ void Logger::initWebSerial(RecvMsgHandler  cbMsgHandler, void* context, char *pa
   webSerialParam.cbContext    = context;
   webSerialParam.port         = port;
   strcpy(webSerialParam.path,path);
-  WebSerial.initBuffer(4*1024,200);
+  webSerialParam.historySize  = LOG_HISTORY_SIZE;
+  webSerialParam.historyMsg   = LOG_HISTORY_MSG;
 }
 
-void Logger::initSerial(uint32_t serialSpeed) {
+void Logger::initSerial(uint32_t serialSpeed, bool timePrefix, uint16_t ringSize, uint8_t policy) {
   this->serialSpeed = serialSpeed;
+  this->serialTime  = timePrefix;
+  this->serialRing  = (policy == LOG_SERIAL_BLOCK) ? 0 : ringSize;
+  serialSink.setPolicy(policy);
+}
+
+/* Needs the WebView history and LittleFS, mounted when the first snapshot is written or listed */
+void Logger::initSnapshot(uint8_t slots, uint16_t after, uint32_t interval) {
+  snapshot.begin(slots, after, interval);
 }
 
 void Logger::initNTP(const char* poolServerName, long timeOffset, unsigned long updateInterval) {
@@ -72,42 +119,403 @@ void Logger::initNTP(const char* poolServerName, long timeOffset, unsigned long
 }
 
 
+void Logger::setFormat(uint8_t sink, uint8_t format) {
+  if (sink >= LOG_SINKS) return;
+  if ((format == LOG_FORMAT_BINARY) && (sink != LOG_SINK_SERIAL)) return;
+
+  this->format[sink] = format;
+  if (sink == LOG_SINK_SERIAL) serialSink.setFramed(format == LOG_FORMAT_BINARY);
+}
+
+void Logger::setRateLimit(uint8_t pri, uint16_t rate, uint16_t burst) {
+  limiter.setLimit(pri, rate, burst);
+}
+
+LogModule Logger::registerModule(const char* name, uint8_t level) {
+  LogModule module = { 0 };
+
+  for (uint8_t i=0; i<nbModules; i++)
+    if (strcmp(modules[i], name) == 0) {
+      module.id = i;
+      return module;
+    }
+  if (nbModules == LOG_MODULES) return module;    // table full, logged as main
+
+  module.id          = nbModules++;
+  modules[module.id] = name;
+  levels[module.id]  = level;
+  return module;
+}
+
+void Logger::setLevel(LogModule module, uint8_t level) {
+  if (module.id < nbModules) levels[module.id] = level;
+}
+
+bool Logger::setLevel(const char* name, uint8_t level) {
+  for (uint8_t i=0; i<nbModules; i++)
+    if (strcmp(modules[i], name) == 0) {
+      levels[i] = level;
+      return true;
+    }
+  return false;
+}
+
+/* "#Modules main=7,wifi=5" for the web page */
+void Logger::sendModules() {
+  char      line[LOG_MODULES * 20];
+  LogWriter w(line, sizeof(line));
+
+  w.str("#Modules ");
+  for (uint8_t i=0; i<nbModules; i++) {
+    if (i) w.chr(',');
+    w.str(modules[i]).chr('=').u32(levels[i]);
+  }
+  WebSerial.control(w.c_str());
+}
+
+void Logger::setBudget(size_t budget) {
+  this->budget = budget;
+}
+
+/* Memory needed by the current configuration, unless a budget is set */
+size_t Logger::getBudget() {
+  if (budget) return budget;
+
+  size_t needed = LogArena::footprint(bufferSize) + LogArena::footprint(serialRing) + LogArena::footprint(SaveCrash.size()) + networkFootprint();
+  if (webSerialParam.port)      needed += WebSerialSM::footprint(webSerialParam.historySize, webSerialParam.historyMsg);
+  return needed;
+}
+
+/* Objects created once the network is up, kept free in the arena until then */
+size_t Logger::networkFootprint() {
+  size_t needed = 0;
+  if (ntpParam.poolServerName || syslogParam.port) needed += LogArena::footprint(sizeof(WiFiUDP));
+  if (syslogParam.port)         needed += LogArena::footprint(sizeof(Syslog));
+  if (webSerialParam.port)      needed += LogArena::footprint(sizeof(AsyncWebServer));
+  return needed;
+}
+
+void Logger::printBudget(Print& out) {
+  arena.printReport(out);
+  WebSerial.printHistoryReport(out);
+}
+
+
 void Logger::begin() {
+  boot.mark(LOG_BOOT_BEGIN);
   Serial.begin(serialSpeed);
-  udpClient = new WiFiUDP();
 
-  if (ntpParam.poolServerName) {
-    timeClient = new NTPClient(*udpClient, ntpParam.poolServerName, ntpParam.timeOffset, ntpParam.updateInterval);
-    timeClient->begin();
-    timeClient->update();
-    EspSaveCrash::_timeOffset = timeClient->getEpochTime() - (int)(millis()/1000);    
-  }
-  else 
-   EspSaveCrash::_timeOffset = 0;
+  // one allocation for all buffers and objects, the history comes last and takes what is left
+  arena.begin(getBudget());
+  buffer = (char*) arena.alloc(bufferSize, "format buffer");
+  if (serialRing) serialSink.begin(arena.alloc(serialRing, "serial ring"), serialRing);
+  SaveCrash.begin((uint8_t*) arena.alloc(SaveCrash.size(), "crash image"));
 
-  if (webSerialParam.port) {
-    serverWeb = new AsyncWebServer(webSerialParam.port);
-    serverWeb->begin();
-    WebSerial.setCallback((void*)this, cbWebSerialMsg, cbWebSerialConnect);
-    WebSerial.begin(serverWeb, webSerialParam.path, EspSaveCrash::_timeOffset); 
-  }
+  // the clock is set by handle() once NTP answers, records logged before get their time then
+  EspSaveCrash::_timeOffset = 0;
+  LogTime.setEpochOffset(0);
+
+  // the history is there from the start, the web server comes with the network
+  if (webSerialParam.port) WebSerial.initBuffer(webSerialParam.historySize, webSerialParam.historyMsg, &arena, networkFootprint());
+  started = true;
+
+  // messages logged before begin(), with their own number and time
+  boot.forEach([&](const tHistoryRecord &record, const char *text) -> bool {
+    serialWrite(record.pri, text, record.len, record.seq);
+    if (toWeb(record.pri)) WebSerial.store(record.pri, text, record.len, record.seq, record.ms);
+    return true;
+  });
+  if (!syslogParam.port) boot.clear();
 
+  if (arena.getMissing()) print(LOG_ERR, "Logger: memory budget %u bytes too small, see printBudget()\n", arena.getMissing());
+  if (WiFi.status() == WL_CONNECTED) startNetwork();
+  boot.mark(LOG_BOOT_READY);
+}
+
+/* UDP, NTP, syslog and web server, created when WiFi is first seen connected */
+void Logger::startNetwork() {
+  size_t missing = arena.getMissing();
+  boot.mark(LOG_BOOT_NETWORK);
+  online = true;
+
+  if (ntpParam.poolServerName || syslogParam.port)
+    udpClient = arena.create<WiFiUDP>("udp client");
+
+  if ((ntpParam.poolServerName) && (udpClient))
+    ntp.begin(udpClient, ntpParam.poolServerName, ntpParam.timeOffset, ntpParam.updateInterval);
 
-  if (syslogParam.port) {  
-    syslog    = new Syslog(*udpClient, syslogParam.serverIP, syslogParam.port, syslogParam.deviceName, syslogParam.appName, LOG_KERN);
+  if ((syslogParam.port) && (udpClient)) {
+    syslog    = arena.create<Syslog>("syslog", *udpClient, syslogParam.serverIP, syslogParam.port, syslogParam.deviceName, syslogParam.appName, LOG_KERN);
+
+    // messages logged while the network was down
+    if (syslog) boot.forEach([&](const tHistoryRecord &record, const char *text) -> bool {
+      if ((record.pri > LOG_NOTICE) || (!buffer)) return true;
+      size_t len = std::min((size_t) record.len, (size_t) bufferSize - 1);
+      memcpy(buffer, text, len);
+      buffer[len] = '\0';
+      syslog->log(record.pri, buffer);
+      return true;
+    });
   }
-  
+  boot.clear();
 
- }
+  if (webSerialParam.port) serverWeb = arena.create<AsyncWebServer>("web server", webSerialParam.port);
+  if (serverWeb) {
+    serverWeb->begin();
+    WebSerial.setCallback((void*)this, cbWebSerialMsg, cbWebSerialConnect, cbWebSerialSeq);
+    WebSerial.begin(serverWeb, webSerialParam.path, EspSaveCrash::_timeOffset); 
+    if (snapshot.isEnabled()) snapshot.serve(serverWeb, webSerialParam.path);
+  }
+  if (arena.getMissing() > missing) print(LOG_ERR, "Logger: memory budget %u bytes too small, see printBudget()\n", arena.getMissing());
+  boot.mark(LOG_BOOT_ONLINE);
+}
   
 void Logger::printf(uint8_t pri, char *fmt, ...) {
+    if (pri > levels[0]) return;
 
     va_list argp;
     va_start(argp, fmt);
-    vsnprintf( buffer, bufferSize, fmt, argp);  
+    log(pri, fmt, argp);
     va_end(argp);
-  
-    Serial.printf("%s",buffer);
-    if ((webSerialParam.port) && (pri<=LOG_INFO)   ) WebSerial.prints(pri, buffer );
-    if ((syslogParam.port)    && (pri<=LOG_NOTICE) ) syslog->logf(pri,buffer);
+}
+
+void Logger::printf(LogModule module, uint8_t pri, char *fmt, ...) {
+    // a single load and compare for the statements of a muted module
+    if (pri > levels[module.id]) return;
+
+    va_list argp;
+    va_start(argp, fmt);
+    log(pri, fmt, argp);
+    va_end(argp);
+}
+
+/* Rate limit and flight recorder, false when the message is dropped */
+bool Logger::admit(uint8_t pri, const char *fmt) {
+    // checked before formatting, a flooding statement costs a table lookup only
+    if (!limiter.allow(fmt, pri, millis())) return false;
+    if (pri <= LOG_CRIT) snapshot.trigger(seq + 1, millis());
+    return true;
+}
+
+static int formatVa(char *buf, size_t size, const char *fmt, void *args) {
+    va_list copy;
+    va_copy(copy, *(va_list*) args);
+    int len = vsnprintf(buf, size, fmt, copy);
+    va_end(copy);
+    return len;
+}
+
+typedef struct {
+    const LogArg  *list;
+    uint8_t       count;
+} tLogArgs;
+
+static int formatArgs(char *buf, size_t size, const char *fmt, void *args) {
+    LogWriter w(buf, size);
+    LogFmt::format(w, fmt, ((tLogArgs*) args)->list, ((tLogArgs*) args)->count);
+    return w.full() ? size : w.length();      // as vsnprintf: size or more when truncated
+}
+
+void Logger::log(uint8_t pri, const char *fmt, va_list argp) {
+    if (!admit(pri, fmt)) return;
+
+    // binary Serial records carry the arguments, the text is formatted only for the other sinks
+    bool     serial = true;
+    uint32_t id     = 0;
+    va_list  args;
+    va_copy(args, argp);
+    if ((started) && (format[LOG_SINK_SERIAL] == LOG_FORMAT_BINARY)) {
+      serial = !binaryLog.printf(seq + 1, pri, fmt, argp);
+      if (!serial) id = ++seq;
+    }
+    if ((serial) || (toWeb(pri)) || (toSyslog(pri)) || (toBoot(pri))) compose(pri, fmt, formatVa, &args, id, serial);
+    va_end(args);
+}
+
+void Logger::log(uint8_t pri, const char *fmt, const LogArg *list, uint8_t count) {
+    if (!admit(pri, fmt)) return;
+
+    tLogArgs args = { list, count };
+    compose(pri, fmt, formatArgs, &args, 0, true);
+}
+
+/* Message text formatted once, into the history slot when it fits, and sent to the sinks */
+void Logger::compose(uint8_t pri, const char *fmt, tLogFormat formatter, void *args, uint32_t id, bool serial) {
+    char early[LOG_EARLY_SIZE];
+
+    // formatted straight into the history when the open block has room for it, the other sinks read it there.
+    // Not while repeats are counted: their summary may have to go out first, ahead of the slot in the history
+    size_t capacity;
+    char   *slot = ((toWeb(pri)) && (!repeatCount)) ? WebSerial.reserve(pri, LOG_RESERVE_MIN, bufferSize, capacity) : NULL;
+    if (slot) {
+      int len = formatter(slot, capacity, fmt, args);
+      if ((len >= 0) && ((size_t) len < capacity)) {
+        if (repeated(pri, slot, len)) WebSerial.cancel(slot);
+        else output(pri, slot, len, id ? id : ++seq, serial, slot);
+        return;
+      }
+      WebSerial.cancel(slot);
+    }
+
+    // before begin() the message goes through a stack buffer to the boot buffer
+    char     *buf  = buffer ? buffer : early;
+    uint16_t size  = buffer ? bufferSize : LOG_EARLY_SIZE;
+
+    int len = formatter(buf, size, fmt, args);
+    if (len < 0) return;
+    if (len >= size) len = size - 1;
+
+    if (!repeated(pri, buf, len)) output(pri, buf, len, id ? id : ++seq, serial);
+}
+
+/* Hexdump rows, rate limited as one statement */
+void Logger::dump(uint8_t pri, const void *data, size_t len) {
+    static const char site[] = "hexdump";
+    char              line[LOG_HEX_LINE_SIZE];
+    const uint8_t     *bytes = (const uint8_t*) data;
+
+    if (!admit(pri, site)) return;
+    for (size_t pos = 0; pos < len; pos += LOG_HEX_LINE_BYTES) {
+      size_t n = LogHex::line(line, (uint32_t) (uintptr_t) (bytes + pos), bytes + pos, std::min(len - pos, (size_t) LOG_HEX_LINE_BYTES));
+      output(pri, line, n, ++seq);
+    }
+}
+
+/* Periodic work, to be called from loop() */
+void Logger::handle() {
+    uint8_t  pri;
+    uint16_t suppressed;
+
+    boot.mark(LOG_BOOT_LOOP);
+    if (!started) return;
+    if ((!online) && (WiFi.status() == WL_CONNECTED)) startNetwork();
+    if ((repeatCount) && (millis() - repeatSince >= LOG_REPEAT_TIMEOUT)) flushRepeated();
+    while (limiter.expired(millis(), pri, suppressed)) outputSuppressed(pri, suppressed);
+    serialSink.drain();
+    WebSerial.handle();
+    binaryLog.handle(millis());
+    if (snapshot.isDue(seq, millis())) snapshot.save(WebSerial.getHistory());
+    if (ntp.handle()) {
+      boot.mark(LOG_BOOT_CLOCK);
+      clockSet();
+    }
+}
+
+/* NTP answered: crash reports and pages get the new time, the step tells the drift since the last sync */
+void Logger::clockSet() {
+    char      line[64];
+    LogWriter w(line, sizeof(line));
+
+    EspSaveCrash::_timeOffset = LogTime.getEpochOffset();
+    if (ntp.getSyncs() == 1) w.str("NTP: clock set\n");
+    else                     w.str("NTP: clock corrected by ").i32(ntp.getLastStep()).str(" ms\n");
+    output(LOG_INFO, line, w.length(), ++seq);
+}
+
+/**
+ * Send a formatted message to the sinks, none of them allocates nor waits for the UART.
+ * buf is the slot reserved in the history when given, committed once the other sinks have read it.
+ */
+void Logger::output(uint8_t pri, const char *buf, size_t len, uint32_t id, bool serial, char *slot) {
+    if ((serial) && (started)) serialWrite(pri, buf, len, id);
+    if (toSyslog(pri)) syslog->log(pri, buf);
+    if (toBoot(pri))   boot.add(id, millis(), pri, buf, len);
+    if (slot)          WebSerial.commit(slot, pri, id, len);
+    else if (toWeb(pri)) WebSerial.prints(pri, (char*) buf, id);
+}
+
+void Logger::serialWrite(uint8_t pri, const char *buf, size_t len, uint32_t id) {
+    if (format[LOG_SINK_SERIAL] == LOG_FORMAT_BINARY) binaryLog.text(id, pri, buf, len);
+    else serialSink.write(serialTime ? LogTime.getPrefix() : NULL, serialTime ? LOG_PREFIX_SIZE - 1 : 0, buf, len);
+}
+
+/* Summary of the messages dropped by the rate limit, sent by handle() at most once per LOG_LIMIT_SUMMARY and statement */
+void Logger::outputSuppressed(uint8_t pri, uint16_t suppressed) {
+    char      line[48];
+    LogWriter w(line, sizeof(line));
+
+    w.str("Rate limit: ").u32(suppressed).str(" messages suppressed\n");
+    output(pri, line, w.length(), ++seq);
+}
+
+/**
+ * True when the message is the same as the previous one: it is only counted.
+ * Messages are compared by priority, length and FNV-1a hash, the previous text is not kept.
+ */
+bool Logger::repeated(uint8_t pri, const char *buf, size_t len) {
+    uint32_t hash = 2166136261u;
+    for (size_t i=0; i<len; i++) hash = (hash ^ (uint8_t) buf[i]) * 16777619u;
+
+    if ((hash == lastHash) && (len == lastLen) && (pri == lastPri)) {
+      if (!repeatCount) repeatSince = millis();
+      if (++repeatCount == 0xFFFF) flushRepeated();
+      return true;
+    }
+
+    if (repeatCount) flushRepeated();
+    lastHash = hash;
+    lastLen  = len;
+    lastPri  = pri;
+    return false;
+}
+
+/* Single line for the repeats counted since the previous one went out */
+void Logger::flushRepeated() {
+    char      line[48];
+    LogWriter w(line, sizeof(line));
+
+    w.str("Last message repeated ").u32(repeatCount).str(" times\n");
+    repeatCount = 0;
+    output(lastPri, line, w.length(), ++seq);
+}
+
+/* End of the Log.event() statement, here so that LogEvent.cpp does not depend on the sinks */
+LogEvent::~LogEvent() {
+    if (logger) logger->emit(*this);
+}
+
+/* Render a structured event for each sink in its format, the rendering is reused when formats match */
+void Logger::emit(const LogEvent& event) {
+    char     early[LOG_EARLY_SIZE];
+    uint8_t  pri      = event.getPri();
+
+    if (!limiter.allow(event.getName(), pri, millis())) return;
+    if (pri <= LOG_CRIT) snapshot.trigger(seq + 1, millis());
+
+    bool     binary   = (started) && (format[LOG_SINK_SERIAL] == LOG_FORMAT_BINARY);
+    bool     web      = toWeb(pri);
+    bool     sys      = toSyslog(pri);
+    bool     kept     = toBoot(pri);
+
+    uint32_t id       = 0;
+    if (binary) {
+      binaryLog.event(id = ++seq, pri, event);
+      if ((!web) && (!sys) && (!kept)) return;
+    }
+
+    char     *buf     = buffer ? buffer : early;
+    uint16_t size     = buffer ? bufferSize : LOG_EARLY_SIZE;
+    uint8_t  rendered = binary ? format[web ? LOG_SINK_WEB : LOG_SINK_SYSLOG] : format[LOG_SINK_SERIAL];
+    size_t   len      = event.render(buf, size, rendered);
+
+    if (repeated(pri, buf, len)) return;
+
+    if (!binary) {
+      id = ++seq;
+      if (started) serialWrite(pri, buf, len, id);
+    }
+
+    if (web) {
+      if (rendered != format[LOG_SINK_WEB]) len = event.render(buf, size, rendered = format[LOG_SINK_WEB]);
+      WebSerial.prints(pri, buf, id);
+    }
+    if (sys) {
+      if (rendered != format[LOG_SINK_SYSLOG]) len = event.render(buf, size, rendered = format[LOG_SINK_SYSLOG]);
+      syslog->log(pri, buf);
+    }
+    if (kept) {
+      // once begin() is done, only syslog is waiting for the network
+      if ((started) && (rendered != format[LOG_SINK_SYSLOG])) len = event.render(buf, size, rendered = format[LOG_SINK_SYSLOG]);
+      boot.add(id, millis(), pri, buf, len);
+    }
 }
@@ -12,6 +12,20 @@ RotatingBuffer::RotatingBuffer(short size, short nbMsg) {
     reset();
 }
 
+RotatingBuffer::RotatingBuffer(short size, short nbMsg, void* memory) {
+    this->size = size;
+    this->nbMsg = nbMsg+1;
+
+    myPos = (short*) memory;
+    myBuffer = (char*) memory + this->nbMsg * sizeof(short);
+
+    reset();
+}
+
+size_t  RotatingBuffer::memorySize(short size, short nbMsg) {
+    return (nbMsg+1) * sizeof(short) + size + 1;
+}
+
 void    RotatingBuffer::reset() {
     for (int i=0;i<nbMsg;i++) myPos[i] = 999;
     myPos[0] = 0;
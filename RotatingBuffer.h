@@ -16,6 +16,8 @@ private:
 
 public:
             RotatingBuffer(short size, short nbMsg);
+            RotatingBuffer(short size, short nbMsg, void* memory);       // memory of memorySize() bytes, not freed
+    static size_t memorySize(short size, short nbMsg);
     void    reset();
     void    addString(char* str);                                         // copy string to buffer    
     void    getStatus(short &cpt, short &size);
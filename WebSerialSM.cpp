@@ -1,17 +1,7 @@
 #include "WebSerialSM.h"
 #include "WebSerialSM_webpage.h"
 #include "ESPsaveCrashND.h"
-#include "RotatingBuffer.h"
-#include <time.h>
-
-#define LOG_EMERG     0 /* system is unusable */
-#define LOG_ALERT     1 /* action must be taken immediately */
-#define LOG_CRIT      2 /* critical conditions */
-#define LOG_ERR       3 /* error conditions */
-#define LOG_WARNING   4 /* warning conditions */
-#define LOG_NOTICE    5 /* normal but significant condition */
-#define LOG_INFO      6 /* informational */
-#define LOG_DEBUG     7 /* debug-level messages */
+#include "LogFormat.h"
 
 extern EspSaveCrash SaveCrash;
 
@@ -24,43 +14,138 @@ WebSerialSM::WebSerialSM() {
   _debug        = false;
   _time         = true;
   _buf          = NULL;  
-  _timeOffset   = NULL;
+  _kept         = NULL;
+  memset(_dumps, 0, sizeof(_dumps));
 }
 
-void WebSerialSM::initBuffer(short size, short nbMsg){
-  _buf = new  RotatingBuffer(size, nbMsg);  
+/* Part of the history given to the records of priority pri or higher once their block is dropped, 0 for plain oldest first */
+void WebSerialSM::setRetention(uint8_t pri, uint8_t percent) {
+  _keptPri     = pri;
+  _keptPercent = percent;
 }
 
+/* Bytes of the history memory left to the kept records, 0 when too small to hold a block */
+size_t WebSerialSM::keptSize(size_t size) {
+  return LogHistory::keptSize(size, _keptPercent, _compress);
+}
+
+void WebSerialSM::initBuffer(short size, short nbMsg, LogArena *arena, size_t reserve){
+  _arena = arena;
+  if (!_arena) {
+    uint8_t *memory = (uint8_t*) malloc(size);
+    size_t   kept   = keptSize(size);
+    if (!memory) return;
+    _buf = new LogHistory(memory, size - kept, _compress);
+    if (kept) _kept = new LogHistory(memory + size - kept, kept, false);
+    if (_kept) _buf->setKept(_kept, _keptPri);
+    return;
+  }
+
+  // history takes what is left of the budget when it cannot get the requested size
+  size_t reserved = WebSerialSM::footprint(0, nbMsg) + reserve;
+  size_t left     = (_arena->available() > reserved) ? (_arena->available() - reserved) & ~(LOG_ARENA_ALIGN - 1) : 0;
+  if ((size_t) size > left) size = left;
+  if ((size_t) size <= LOG_HISTORY_BLOCK + LogHistory::scratchSize(_compress)) return;
+
+  // the kept records are few and rarely added, they are not compressed
+  uint8_t *memory = (uint8_t*) _arena->alloc(size, "history");
+  size_t   kept   = keptSize(size);
+  if (!memory) return;
+  _buf = _arena->create<LogHistory>("history index", memory, (size_t) size - kept, _compress);
+  if (kept) _kept = _arena->create<LogHistory>("history kept", memory + size - kept, kept, false);
+  if ((_buf) && (_kept)) _buf->setKept(_kept, _keptPri);
+}
+
+size_t WebSerialSM::footprint(short size, short nbMsg) {
+  return LogArena::footprint(size) +
+         2 * LogArena::footprint(sizeof(LogHistory)) +
+         LogArena::footprint(sizeof(AsyncWebSocket));
+}
+
+
+/* "hh:mm[:ss]" wall clock time, or a millis() value */
+static bool parseMillis(const char *text, uint32_t &ms) {
+  if (strchr(text, ':')) return LogTime.parseTime(text, ms);
+  ms = strtoul(text, NULL, 10);
+  return true;
+}
 
 void WebSerialSM::begin(AsyncWebServer *server, const char* url, uint32_t timeOffset){
   
     _server = server;
-    _ws = new AsyncWebSocket("/webserialws");
-    _timeOffset = timeOffset;    
+    _ws = _arena ? _arena->create<AsyncWebSocket>("websocket", "/webserialws") : new AsyncWebSocket("/webserialws");
+    if (!_ws) return;       // budget too small, reported by the arena
+    if (timeOffset) LogTime.setEpochOffset(timeOffset);
 
     _server->on(url, HTTP_GET, [](AsyncWebServerRequest *request){
         // Send Webpage
         AsyncWebServerResponse *response = request->beginResponse_P(200, "text/html", WEBSERIAL_HTML, WEBSERIAL_HTML_SIZE);
         response->addHeader("Content-Encoding","gzip");
-        request->send(response);   
-        
+        request->send(response);
+
+    });
+
+    // Crash data sets for tooling, served from the SaveCrash RAM cache
+    _server->on("/crash.json", HTTP_GET, [](AsyncWebServerRequest *request){
+        AsyncResponseStream *response = request->beginResponseStream("application/json");
+        SaveCrash.printJson(*response);
+        request->send(response);
+    });
+
+    _server->on("/crash.bin", HTTP_GET, [](AsyncWebServerRequest *request){
+        AsyncResponseStream *response = request->beginResponseStream("application/octet-stream");
+        SaveCrash.printBinary(*response);
+        request->send(response);
+    });
+
+    // records after since, for polling collectors and reconnecting pages
+    char path[48];
+    snprintf(path, sizeof(path), "%s/tail", url);
+    _server->on(path, HTTP_GET, [&](AsyncWebServerRequest *request){
+        AsyncResponseStream *response = request->beginResponseStream("application/json");
+        uint32_t since = request->hasParam("since") ? strtoul(request->getParam("since")->value().c_str(), NULL, 10) : 0;
+        uint16_t limit = request->hasParam("limit") ? strtoul(request->getParam("limit")->value().c_str(), NULL, 10) : WEBSERIAL_TAIL_MAX;
+        printTail(*response, since, limit);
+        request->send(response);
+    });
+
+    // records holding words, e.g. <url>/find?q=wifi+timeout
+    snprintf(path, sizeof(path), "%s/find", url);
+    _server->on(path, HTTP_GET, [&](AsyncWebServerRequest *request){
+        AsyncResponseStream *response = request->beginResponseStream("application/json");
+        String   words = request->hasParam("q") ? request->getParam("q")->value() : String();
+        uint16_t limit = request->hasParam("limit") ? strtoul(request->getParam("limit")->value().c_str(), NULL, 10) : WEBSERIAL_TAIL_MAX;
+        printFindJson(*response, words.c_str(), limit);
+        request->send(response);
+    });
+
+    // records of a time window, e.g. <url>/range?from=14:05&to=14:10, or millis() values
+    snprintf(path, sizeof(path), "%s/range", url);
+    _server->on(path, HTTP_GET, [&](AsyncWebServerRequest *request){
+        AsyncResponseStream *response = request->beginResponseStream("application/json");
+        uint32_t from  = 0, to = millis();
+        uint16_t limit = request->hasParam("limit") ? strtoul(request->getParam("limit")->value().c_str(), NULL, 10) : WEBSERIAL_TAIL_MAX;
+        if (request->hasParam("from")) parseMillis(request->getParam("from")->value().c_str(), from);
+        if (request->hasParam("to"))   parseMillis(request->getParam("to")->value().c_str(), to);
+        printRangeJson(*response, from, to, limit);
+        request->send(response);
     });
 
     _ws->onEvent([&](AsyncWebSocket * server, AsyncWebSocketClient * client, AwsEventType type, void * arg, uint8_t *data, size_t len) -> void {
         if(type == WS_EVT_CONNECT){
             _isConnected = true; 
-       
-            SaveCrash.print(_strBuf,MAX_SPRINTF_SIZE - 1);
-            _ws->textAll(_strBuf);
 
-            if ( (_buf) && !(_buf->isEmpty()) ) {
-              _ws->textAll("Last saved messages\n");            
-              pushLastMsg();
-            } else _ws->textAll("No message saved\n");             
+            // a page reconnecting with ?since=<last record it got> only gets the newer records
+            AsyncWebServerRequest *request = (AsyncWebServerRequest*) arg;
+            uint32_t since = ((request) && (request->hasParam("since"))) ? strtoul(request->getParam("since")->value().c_str(), NULL, 10) : 0;
+            if ((!_buf) || ((int32_t) (since - _buf->getLastSeq()) > 0)) since = 0;      // the device restarted since
+            char seqMsg[16];
+            snprintf(seqMsg, sizeof(seqMsg), "#Seq %u", (unsigned) since);
+            client->text(seqMsg);
+
+            // crash report and history follow from handle(), as fast as the client takes them
+            startDump(client, since);
 
-            if (_debug) _ws->textAll("#DebugON");            
-            if (_time) _ws->textAll("#TimeON");
-            
             if (_connectFunc) _connectFunc(_context, true); 
 
 
@@ -69,6 +154,11 @@ void WebSerialSM::begin(AsyncWebServer *server, const char* url, uint32_t timeOf
             
             if (_connectFunc) _connectFunc(_context, false); 
             _isConnected = false;
+            for (uint8_t i=0; i<WEBSERIAL_DUMPS; i++) {
+              if (_dumps[i].client != client->id()) continue;
+              _dumps[i].client = 0;
+              _nbDumps--;
+            }
             
         } else if(type == WS_EVT_DATA){
             
@@ -95,6 +185,18 @@ void WebSerialSM::begin(AsyncWebServer *server, const char* url, uint32_t timeOf
             } else if (strcmp(msg,"#TimeOFF#") == 0) {
               _time = false;
               _ws->textAll("Time = OFF \n");
+            } else if ((strncmp(msg, "#Find ", 6) == 0) && (len > 7) && (msg[len - 1] == '#')) {
+              msg[len - 1] = 0;
+              WebSocketPrint out(_ws, client);
+              printFind(out, msg + 6);
+            } else if ((strncmp(msg, "#Since ", 7) == 0) && (len > 8) && (msg[len - 1] == '#')) {
+              // "#Since hh:mm:ss#" or "#Since hh:mm:ss hh:mm:ss#"
+              uint32_t from, to = millis();
+              char    *end = strchr(msg + 7, ' ');
+              msg[len - 1] = 0;
+              WebSocketPrint out(_ws, client);
+              if ((!LogTime.parseTime(msg + 7, from)) || ((end) && (!LogTime.parseTime(end + 1, to)))) out.print("Since: hh:mm:ss expected\n");
+              else printRange(out, from, to);
             } else {
               if ((_recvFunc) && (len != 0))  _recvFunc(_context, msg);      // zero size means hear beat
             }
@@ -105,72 +207,381 @@ void WebSerialSM::begin(AsyncWebServer *server, const char* url, uint32_t timeOf
     _server->addHandler(_ws);
 }
 
-void WebSerialSM::setCallback(void *_ctx, RecvMsgHandler _recv, EvtConnectHandler _connect){
+void WebSerialSM::setCallback(void *_ctx, RecvMsgHandler _recv, EvtConnectHandler _connect, SeqHandler _seq){
     _recvFunc     = _recv;
-    _connectFunc  = _connect;    
+    _connectFunc  = _connect;
+    _seqFunc      = _seq;    
     _context      = _ctx;
 }
 
+/* Records after since, as long as the clients take them, returns the last one queued */
+uint32_t WebSerialSM::pushLastMsg(WebSocketPrint &out, uint32_t since) {
+  if (!_buf) return since;
+
+  _buf->forEach(since, [&](const tHistoryRecord &record, const char *text) -> bool {
+    printRecord(out, record.pri, record.seq, record.ms, text, record.len);
+    out.mark(record.seq);
+    return !out.isFull();
+  });
+  out.flush();
+  return out.getSentSeq() ? out.getSentSeq() : since;
+}
+
+/* Crash report and history for a new page, sent by handle() as the client takes them */
+void WebSerialSM::startDump(AsyncWebSocketClient *client, uint32_t since) {
+  for (uint8_t i=0; i<WEBSERIAL_DUMPS; i++) {
+    if (_dumps[i].client) continue;
+    _dumps[i].client = client->id();
+    _dumps[i].since  = since;
+    _dumps[i].crash  = 0;
+    _dumps[i].step   = since ? WEBSERIAL_DUMP_LOST : WEBSERIAL_DUMP_CRASH;
+    _nbDumps++;
+    return;
+  }
+  client->text("... history not sent, too many pages connecting\n");
+  if (_debug) client->text("#DebugON");
+  if (_time) client->text("#TimeON");
+}
+
+/**
+ * Next frames of a dump, true once it is complete.
+ * The crash report is rendered again on each call and skips what the client already got.
+ */
+bool WebSerialSM::sendDump(tWebDump &dump, AsyncWebSocketClient *client) {
+  if (dump.step == WEBSERIAL_DUMP_CRASH) {
+    WebSocketPrint out(_ws, client, dump.crash);
+    SaveCrash.print(out);
+    out.flush();
+    dump.crash = out.getSent();
+    if (out.isFull()) return false;
+    dump.step = WEBSERIAL_DUMP_HEADER;
+  }
+  if (dump.step == WEBSERIAL_DUMP_HEADER) {
+    if (!client->canSend()) return false;
+    bool saved = (_buf) && !(_buf->isEmpty());
+    client->text(saved ? "Last saved messages\n" : "No message saved\n");
+    dump.since = saved ? _buf->firstSeq() - 1 : (_buf ? _buf->getLastSeq() : 0);
+    dump.step  = WEBSERIAL_DUMP_HISTORY;
+  }
+  if (dump.step == WEBSERIAL_DUMP_LOST) {
+    if (!client->canSend()) return false;
+    uint32_t lost = _buf ? _buf->lost(dump.since) : 0;
+    if (lost) {
+      char      line[40];
+      LogWriter w(line, sizeof(line));
+      w.str("... ").u32(lost).str(" messages lost\n");
+      client->text(line);
+    }
+    dump.step = WEBSERIAL_DUMP_HISTORY;
+  }
+  if (dump.step == WEBSERIAL_DUMP_HISTORY) {
+    if ((_buf) && !(_buf->isEmpty())) {
+      WebSocketPrint out(_ws, client);
+      dump.since = pushLastMsg(out, dump.since);
+      if (out.isFull()) return false;
+    }
+    dump.step = WEBSERIAL_DUMP_DEBUG;
+  }
+  if (dump.step == WEBSERIAL_DUMP_DEBUG) {
+    if (!client->canSend()) return false;
+    if (_debug) client->text("#DebugON");
+    dump.step = WEBSERIAL_DUMP_TIME;
+  }
+  if (dump.step == WEBSERIAL_DUMP_TIME) {
+    if (!client->canSend()) return false;
+    if (_time) client->text("#TimeON");
+    dump.step = WEBSERIAL_DUMP_DONE;
+  }
+  return true;
+}
+
+/* Frames the clients could not take earlier: the pages being filled first, then the new records for all */
+void WebSerialSM::handle() {
+  if (!_ws) return;
+
+  for (uint8_t i=0; i<WEBSERIAL_DUMPS; i++) {
+    tWebDump &dump = _dumps[i];
+    if (!dump.client) continue;
+    AsyncWebSocketClient *client = _ws->client(dump.client);
+    if ((client) && (!sendDump(dump, client))) continue;
+    // a lone page is up to date, it does not need the history again
+    if ((client) && (_ws->count() == 1)) _sentSeq = dump.since;
+    dump.client = 0;
+    _nbDumps--;
+  }
+  if ((_isConnected) && (_ws->availableForWriteAll())) pushLastMsg();
+}
+
+void WebSerialSM::printHistoryReport(Print &out) {
+  if (_buf) _buf->printReport(out);
+}
+
+/* Records not sent yet, to all clients, held while a page is being filled so that it gets them in order */
 void WebSerialSM::pushLastMsg() {
-  char  *head, *tail;
-  short cpt, size;
+  if ((!_buf) || (_nbDumps) || (_buf->getLastSeq() == _sentSeq)) return;
+
+  WebSocketPrint out(_ws);
+  _sentSeq = pushLastMsg(out, _sentSeq);
+}
+
+/* "<prio:seq>" in front of the message, used by the page to colour it and to resume after a reconnection */
+void WebSerialSM::printRecord(Print &out, byte prio, uint32_t seq, uint32_t ms, const char *msg, size_t len) {
+  char      prefix[16 + LOG_PREFIX_SIZE];
+  LogWriter w(prefix, sizeof(prefix));
 
-  if (_buf && (!_buf->isEmpty()) ) {
-    _buf->getHeadTailStrings(head, tail);  
-    _ws->textAll(head);
-    //Serial.printf("Available HEAD %d\n", _ws->availableForWriteAll());
-    _ws->textAll(tail);
-    //Serial.printf("Available TAIL %d\n", _ws->availableForWriteAll());
-    _buf->reset(); 
+  w.chr('<').u32(prio & 7);
+  if (seq) w.chr(':').u32(seq);     // not for search results, the page would take them for records already shown
+  w.chr('>');
+  if (_time) w.str(LogTime.getPrefix(ms), LOG_PREFIX_SIZE - 1);
+  out.write((const uint8_t*) prefix, w.length());
+  out.write((const uint8_t*) msg, len);
+}
+
+static void printJsonText(Print &out, const char *s, size_t len) {
+  out.write('"');
+  for (size_t i=0; i<len; ) {
+    size_t run = 0;
+    while ((i + run < len) && ((uint8_t) s[i + run] >= 0x20) && (s[i + run] != '"') && (s[i + run] != '\\')) run++;
+    if (run) {
+      out.write((const uint8_t*) s + i, run);
+      i += run;
+      continue;
+    }
+    char c = s[i++];
+    if      (c == '\n') out.print("\\n");
+    else if (c == '"')  out.print("\\\"");
+    else if (c == '\\') out.print("\\\\");
+    else                out.printf("\\u%04x", (uint8_t) c);
   }
+  out.write('"');
 }
 
-void WebSerialSM::addMsg(char* msg, bool store) {
-  time_t    rawtime;
-  struct tm ts;
-  char      timeStr[12];
-  
-  if (!_buf && store) return;
+static void printJsonRecord(Print &out, const tHistoryRecord &record, const char *text, uint16_t n) {
+  out.printf("%s{\"seq\":%u,\"ms\":%u,\"pri\":%u,\"msg\":", n ? "," : "", (unsigned) record.seq, (unsigned) record.ms, record.pri);
+  printJsonText(out, text, record.len);
+  out.write('}');
+}
 
-  rawtime = _timeOffset + round(millis()/1000);  
-  ts = *localtime(&rawtime);
-  strftime(timeStr, sizeof(timeStr), "%H:%M:%S - ", &ts);
-  if (store) {
-    if (_time) _buf->addString(timeStr);
-    _buf->addString(msg); 
-  } else {
-   if (_time) _ws->textAll(timeStr);
-   _ws->textAll(msg);
+/**
+ * {"first":12,"last":80,"gap":0,"records":[{"seq":13,"ms":5230,"pri":6,"msg":"..."},...],"more":false}
+ * gap counts the records after since that were overwritten before being read
+ */
+void WebSerialSM::printTail(Print &out, uint32_t since, uint16_t limit) {
+  uint32_t first = _buf ? _buf->firstSeq() : 0;
+  uint32_t last  = _buf ? _buf->getLastSeq() : 0;
+  uint32_t gap   = _buf ? _buf->lost(since) : 0;
+  uint16_t n     = 0;
+  bool     more  = false;
+
+  out.printf("{\"first\":%u,\"last\":%u,\"gap\":%u,\"records\":[", (unsigned) first, (unsigned) last, (unsigned) (since ? gap : 0));
+  if (_buf) _buf->forEach(since, [&](const tHistoryRecord &record, const char *text) -> bool {
+    if (n == limit) {
+      more = true;
+      return false;
+    }
+    printJsonRecord(out, record, text, n++);
+    return true;
+  });
+  out.printf("],\"more\":%s}", more ? "true" : "false");
+}
+
+/* Records holding all the words, for the page: "<prio>" tag without sequence number */
+void WebSerialSM::printFind(Print &out, const char *words) {
+  tHistoryQuery query;
+  uint16_t      n = 0;
+
+  if ((!_buf) || (!LogHistory::parseQuery(words, query))) {
+    out.print("Find: no word to look for\n");
+    return;
   }
+  out.printf("Find: %s\n", words);
+  uint16_t read = _buf->find(query, [&](const tHistoryRecord &record, const char *text) -> bool {
+    printRecord(out, record.pri, 0, record.ms, text, record.len);
+    n++;
+    return true;
+  });
+  out.printf("Find: %u records, %u of %u blocks read\n", n, read, _buf->getBlocks());
 }
 
+/* Records logged between millis() from and to, for the page */
+void WebSerialSM::printRange(Print &out, uint32_t from, uint32_t to) {
+  uint16_t n    = 0;
+  uint16_t read = 0;
 
-void WebSerialSM::prints(byte prio, char *str) {
-  bool send = (prio <= LOG_NOTICE) || (_debug);
+  if (_buf) read = _buf->forRange(from, to, [&](const tHistoryRecord &record, const char *text) -> bool {
+    printRecord(out, record.pri, 0, record.ms, text, record.len);
+    n++;
+    return true;
+  });
+  out.printf("Since: %u records, %u of %u blocks read\n", n, read, _buf ? _buf->getBlocks() : 0);
+}
 
-  if (_isConnected)  {
-    if (_ws->availableForWriteAll()) {
-      pushLastMsg();
+/* {"blocks":40,"read":2,"records":[...],"more":false} */
+void WebSerialSM::printRangeJson(Print &out, uint32_t from, uint32_t to, uint16_t limit) {
+  uint16_t n    = 0;
+  uint16_t read = 0;
+  bool     more = false;
 
-      if (send)
-        if (_ws->availableForWriteAll()) addMsg(str, false);           
-        else addMsg(str, true);           
+  out.print("{\"records\":[");
+  if (_buf) read = _buf->forRange(from, to, [&](const tHistoryRecord &record, const char *text) -> bool {
+    if (n == limit) {
+      more = true;
+      return false;
     }
-    else if (send) addMsg(str, true);     
+    printJsonRecord(out, record, text, n++);
+    return true;
+  });
+  out.printf("],\"blocks\":%u,\"read\":%u,\"more\":%s}", _buf ? _buf->getBlocks() : 0, read, more ? "true" : "false");
+}
+
+/**
+ * {"blocks":40,"read":3,"records":[{"seq":13,"ms":5230,"pri":3,"msg":"..."},...],"more":false}
+ * read is the number of blocks whose summary could match
+ */
+void WebSerialSM::printFindJson(Print &out, const char *words, uint16_t limit) {
+  tHistoryQuery query;
+  uint16_t      n    = 0;
+  uint16_t      read = 0;
+  bool          more = false;
+
+  out.print("{\"records\":[");
+  if ((_buf) && (LogHistory::parseQuery(words, query))) read = _buf->find(query, [&](const tHistoryRecord &record, const char *text) -> bool {
+    if (n == limit) {
+      more = true;
+      return false;
+    }
+    printJsonRecord(out, record, text, n++);
+    return true;
+  });
+  out.printf("],\"blocks\":%u,\"read\":%u,\"more\":%s}", _buf ? _buf->getBlocks() : 0, read, more ? "true" : "false");
+}
+
+void WebSerialSM::prints(byte prio, char *str, uint32_t seq) {
+  if (!seq) seq = _seqFunc ? _seqFunc(_context) : ++_seq;
+
+  // every record goes through the history, the clients get what they have not got yet
+  if (_buf) _buf->add(seq, millis(), prio, str, strlen(str));
+
+  if ((_isConnected) && (_ws->availableForWriteAll())) {
+    if (_buf) pushLastMsg();
+    else {
+      WebSocketPrint out(_ws);
+      printRecord(out, prio, seq, millis(), str, strlen(str));
+    }
+  }
+}
+
+/* Room in the history to format a message in place, NULL if it is not kept or does not fit */
+char* WebSerialSM::reserve(byte prio, size_t minLen, size_t maxLen, size_t &capacity) {
+  if (!_buf) return NULL;
+  return _buf->reserve(minLen, maxLen, capacity);
+}
+
+void WebSerialSM::commit(char *slot, byte prio, uint32_t seq, size_t len) {
+  _buf->commit(slot, seq, millis(), prio, len);
+  if ((_isConnected) && (_ws->availableForWriteAll())) pushLastMsg();
+}
+
+void WebSerialSM::cancel(char *slot) {
+  _buf->cancel(slot);
+}
+
+/* Record logged before the web server exists, kept for the first page */
+void WebSerialSM::store(byte prio, const char *msg, size_t len, uint32_t seq, uint32_t ms) {
+  if (_buf) _buf->add(seq, ms, prio, msg, len);
+}
+
+void WebSerialSM::control(const char *msg) {
+  if ((_isConnected) && (_ws->availableForWriteAll())) _ws->textAll(msg);
+}
+
+void WebSerialSM::printArgs(const char *fmt, const LogArg *list, uint8_t count) {
+  char      strBuf[MAX_SPRINTF_SIZE];
+  LogWriter w(strBuf, sizeof(strBuf));
+
+  LogFmt::format(w, fmt, list, count);
+  prints(WEBSERIAL_PRI, strBuf);
+}
+
+
+
+WebSocketPrint::WebSocketPrint(AsyncWebSocket *ws, AsyncWebSocketClient *client, size_t skip) {
+  _ws      = ws;
+  _client  = client;
+  _len     = 0;
+  _cut     = 0;
+  _markPos = 0;
+  _markSeq = 0;
+  _sentSeq = 0;
+  _sent    = 0;
+  _skip    = skip;
+  _full    = false;
+}
+
+size_t WebSocketPrint::write(uint8_t c) {
+  if (_full) return 0;
+  if (_skip) {
+    _skip--;
+    _sent++;
+    return 1;
+  }
+  _chunk[_len++] = c;
+  if (c == '\n') _cut = _len;
+  if (_len == WEBSERIAL_CHUNK_SIZE) send(_cut ? _cut : charCut());
+  return 1;
+}
+
+size_t WebSocketPrint::write(const uint8_t *buffer, size_t size) {
+  size_t written = 0;
+
+  while ((written < size) && (write(buffer[written]))) written++;
+  return written;
+}
+
+void WebSocketPrint::flush() {
+  if (_len) send(_len);
+}
+
+/* The record seq ends here, the frame may be cut after it */
+void WebSocketPrint::mark(uint32_t seq) {
+  if (_full) return;
+  if (!_len) {
+    _sentSeq = seq;     // its last bytes are already queued
+    return;
   }
-  else
-    if (send) addMsg(str,true);     
+  _cut     = _len;
+  _markPos = _len;
+  _markSeq = seq;
 }
 
-void WebSerialSM::printf(char *fmt, ...) {
+/* Full chunk holding a single line: the frame ends before a UTF-8 character that does not fit whole */
+size_t WebSocketPrint::charCut() {
+  size_t lead = _len - 1;
+  while ((lead) && (((uint8_t) _chunk[lead] & 0xC0) == 0x80)) lead--;
+  uint8_t c    = _chunk[lead];
+  size_t  size = (c < 0x80) ? 1 : (c >= 0xF0) ? 4 : (c >= 0xE0) ? 3 : 2;
+  return ((lead) && (lead + size > _len)) ? lead : _len;
+}
 
-  va_list argp;
-  va_start(argp, fmt);
-  vsnprintf(_strBuf, MAX_SPRINTF_SIZE, fmt, argp);  
-  va_end(argp);
+/* Queues the first len bytes of the chunk as a frame, or refuses everything from now on */
+void WebSocketPrint::send(size_t len) {
+  if (!(_client ? _client->canSend() : _ws->availableForWriteAll())) {
+    _full = true;
+    _len  = 0;
+    return;
+  }
+  if (_client) _client->text(_chunk, len);
+  else         _ws->textAll(_chunk, len);
+  _sent += len;
 
-  prints(LOG_NOTICE, _strBuf);
-   
+  if ((_markSeq) && (_markPos <= len)) {
+    _sentSeq = _markSeq;
+    _markSeq = 0;
+  }
+  _markPos = (_markPos > len) ? _markPos - len : 0;
+  _len    -= len;
+  _cut     = 0;
+  memmove(_chunk, _chunk + len, _len);
 }
 
 
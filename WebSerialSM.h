@@ -3,7 +3,10 @@
 
 #include "Arduino.h"
 #include "stdlib_noniso.h"
-#include "RotatingBuffer.h"
+#include "LogHistory.h"
+#include "LogArena.h"
+#include "LogClock.h"
+#include "LogFormat.h"
 #include <functional>
 
 #if defined(ESP8266)
@@ -18,11 +21,68 @@
     #include "ESPAsyncWebServer.h"
 #endif
 
-#define MAX_SPRINTF_SIZE  (4*1024)
+#define MAX_SPRINTF_SIZE  256          // WebSerialSM::printf stack buffer
+#define WEBSERIAL_CHUNK_SIZE  256      // largest frame sent by WebSocketPrint
+#define WEBSERIAL_TAIL_MAX    100      // records per GET <url>/tail response, unless limit= is given
+#define WEBSERIAL_PRI         5        // LOG_NOTICE, priority of printf()
+#define WEBSERIAL_KEPT_PRI    4        // LOG_WARNING and higher survive a flood of lower priority records...
+#define WEBSERIAL_KEPT_PERCENT 25      // ...in this part of the history
 
 
 typedef std::function<void(void *context, char *data)> RecvMsgHandler;
 typedef std::function<void(void *context, bool isConnected)> EvtConnectHandler;
+typedef std::function<uint32_t(void *context)> SeqHandler;     // next sequence number, shared with the other sinks
+
+// Print adapter cutting its output into WebSocket text frames of at most WEBSERIAL_CHUNK_SIZE bytes
+// sent to one client, or to all clients when client is NULL.
+// A frame ends after a line or a record marked by mark(), a longer line is cut between UTF-8 characters.
+// Frames are only queued while the client can take them: once one is refused the rest is dropped,
+// the caller resumes later from getSentSeq(), or by skipping the getSent() bytes it already got.
+class WebSocketPrint : public Print {
+public:
+    WebSocketPrint(AsyncWebSocket *ws, AsyncWebSocketClient *client = NULL, size_t skip = 0);
+    ~WebSocketPrint() { flush(); };
+    size_t write(uint8_t c) override;
+    size_t write(const uint8_t *buffer, size_t size) override;
+    void   flush() override;
+    void   mark(uint32_t seq);                      // end of the record seq
+    bool   isFull() { return _full; };              // a frame was refused
+    uint32_t getSentSeq() { return _sentSeq; };     // last marked record queued whole, 0 if none
+    size_t getSent() { return _sent; };             // bytes queued, skipped ones included
+
+private:
+    AsyncWebSocket       *_ws;
+    AsyncWebSocketClient *_client;
+    char                  _chunk[WEBSERIAL_CHUNK_SIZE];
+    size_t                _len;
+    size_t                _cut;         // chunk bytes up to the last line or record end
+    size_t                _markPos;     // end of the record _markSeq in the chunk
+    uint32_t              _markSeq;
+    uint32_t              _sentSeq;
+    size_t                _sent;
+    size_t                _skip;
+    bool                  _full;
+
+    size_t charCut();
+    void   send(size_t len);
+};
+
+// Connection streaming the crash report and the history to a new page, resumed by handle()
+#define WEBSERIAL_DUMPS         2       // pages connecting at the same time
+#define WEBSERIAL_DUMP_CRASH    0
+#define WEBSERIAL_DUMP_HEADER   1
+#define WEBSERIAL_DUMP_LOST     2       // a page resuming from since
+#define WEBSERIAL_DUMP_HISTORY  3
+#define WEBSERIAL_DUMP_DEBUG    4
+#define WEBSERIAL_DUMP_TIME     5
+#define WEBSERIAL_DUMP_DONE     6
+
+typedef struct {
+    uint32_t  client;       // AsyncWebSocketClient::id(), 0 for a free slot
+    uint32_t  since;        // last record queued, 0 for a new page
+    size_t    crash;        // bytes of the crash report queued
+    uint8_t   step;         // WEBSERIAL_DUMP_xxx
+} tWebDump;
 
 // Uncomment to enable WebSerialSM debug mode
 // #define WebSerialSM_DEBUG 1
@@ -31,13 +91,36 @@ class WebSerialSM {
 
 public:
     WebSerialSM();
-    void initBuffer(short size, short nbMsg);
+    // history of size bytes (nbMsg is not used any more) and websocket carved from arena if any,
+    // leaving reserve bytes of the arena for objects created later
+    void initBuffer(short size, short nbMsg, LogArena *arena = NULL, size_t reserve = 0);
+    static size_t footprint(short size, short nbMsg);                   // arena bytes needed with initBuffer(size, nbMsg, arena)
+    void setCompression(bool compress) { _compress = compress; };      // before initBuffer, see LogHistory.h
+    void setRetention(uint8_t pri, uint8_t percent);                    // before initBuffer, percent 0 = oldest first only
+    void printHistoryReport(Print &out);
+    LogHistory* getHistory() { return _buf; };
+    void printTail(Print &out, uint32_t since, uint16_t limit = WEBSERIAL_TAIL_MAX);
+    void printFind(Print &out, const char *words);
+    void printFindJson(Print &out, const char *words, uint16_t limit = WEBSERIAL_TAIL_MAX);
+    void printRange(Print &out, uint32_t from, uint32_t to);
+    void printRangeJson(Print &out, uint32_t from, uint32_t to, uint16_t limit = WEBSERIAL_TAIL_MAX);
 
     void begin(AsyncWebServer *server, const char* url = "/Log", uint32_t timeOffset = 0);
-    void setCallback(void* context, RecvMsgHandler _recv, EvtConnectHandler _connect);
-    void printf(char *fmt, ...);
-    void prints(byte prio, char *str);
-    bool getDebug() { return _debug; };
+    void handle();                      // from Logger::handle(), sends what the clients could not take yet
+    void setCallback(void* context, RecvMsgHandler _recv, EvtConnectHandler _connect, SeqHandler _seq = NULL);
+    template<typename... A> void printf(const char *fmt, const A&... args) {    // see LogFmt
+        LogArg list[] = { LogArg(args)..., LogArg() };
+        printArgs(fmt, list, sizeof...(A));
+    };
+    void printArgs(const char *fmt, const LogArg *list, uint8_t count);
+    void prints(byte prio, char *str, uint32_t seq = 0);   // seq 0: next number from the SeqHandler, else counted here
+    // message formatted straight into the history: reserve(), write up to capacity bytes, then commit() or cancel()
+    char* reserve(byte prio, size_t minLen, size_t maxLen, size_t &capacity);
+    void commit(char *slot, byte prio, uint32_t seq, size_t len);
+    void cancel(char *slot);
+    void store(byte prio, const char *msg, size_t len, uint32_t seq, uint32_t ms);   // history only, before begin()
+    void control(const char *msg);      // "#..." message for the web page, not shown nor stored
+    bool getDebug() { return _debug; };   // Debug button of the page, the logger sends it LOG_INFO messages too
     
 
 private:
@@ -47,15 +130,27 @@ private:
     AsyncWebSocket   *_ws           = NULL;
     RecvMsgHandler    _recvFunc     = NULL;
     EvtConnectHandler _connectFunc  = NULL;
+    SeqHandler        _seqFunc      = NULL;
+    uint32_t          _seq          = 0;      // without a SeqHandler
     void*             _context      = NULL;
     bool              _debug        = false;
     bool              _time         = false;
-    RotatingBuffer   *_buf          = NULL;
-    char              _strBuf[MAX_SPRINTF_SIZE];
-    uint32_t          _timeOffset   = NULL;
+    LogHistory       *_buf          = NULL;
+    bool              _compress     = false;
+    LogHistory       *_kept         = NULL;   // records of priority _keptPri or higher dropped from _buf
+    uint8_t           _keptPri      = WEBSERIAL_KEPT_PRI;
+    uint8_t           _keptPercent  = WEBSERIAL_KEPT_PERCENT;
+    uint32_t          _sentSeq      = 0;      // last record sent to the clients
+    LogArena         *_arena        = NULL;
+    tWebDump          _dumps[WEBSERIAL_DUMPS];
+    uint8_t           _nbDumps      = 0;      // slots in use
           
+    void startDump(AsyncWebSocketClient *client, uint32_t since);
+    bool sendDump(tWebDump &dump, AsyncWebSocketClient *client);
+    uint32_t pushLastMsg(WebSocketPrint &out, uint32_t since);
     void pushLastMsg();
-    void addMsg(char* msg, bool store=true);
+    void printRecord(Print &out, byte prio, uint32_t seq, uint32_t ms, const char *msg, size_t len);
+    size_t keptSize(size_t size);
     
 };
 
@@ -3,445 +3,514 @@
 #define WEB_SERIAL_SM_WEB_PAGE
 
 // https://www.mischianti.org/online-converter-file-to-cpp-gzip-byte-array-3/
-const uint32_t WEBSERIAL_HTML_SIZE = 2318;
+const uint32_t WEBSERIAL_HTML_SIZE = 3570;
 const uint8_t WEBSERIAL_HTML[] PROGMEM = { 	
-0x1F, 0x8B, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xCD, 0x5A, 0x5B, 0x73, 0xDB, 0xB6, 
-0x12, 0x7E, 0xF7, 0xAF, 0x80, 0xE1, 0x39, 0x95, 0x34, 0x36, 0x29, 0x39, 0x39, 0x6E, 0x1B, 0xCB, 
-0xF4, 0x4C, 0x62, 0x27, 0x6D, 0x66, 0x92, 0xA6, 0x53, 0xE7, 0x4C, 0x5E, 0xCE, 0x0B, 0x44, 0x42, 
-0x12, 0x63, 0x92, 0xD0, 0x10, 0xA0, 0x6D, 0x25, 0xE3, 0xFF, 0x7E, 0x76, 0x71, 0x21, 0x41, 0x8A, 
-0xF2, 0x2D, 0x69, 0x73, 0xE4, 0x89, 0x45, 0x2E, 0x80, 0xDD, 0x0F, 0xBB, 0x8B, 0xBD, 0xC0, 0x39, 
-0xD9, 0x4D, 0x44, 0xAC, 0xD6, 0x2B, 0x4E, 0x96, 0x2A, 0xCF, 0x4E, 0x77, 0x4E, 0x76, 0x83, 0x80, 
-0xBC, 0x67, 0x8A, 0x97, 0x29, 0xCB, 0x48, 0xC2, 0x65, 0xBA, 0x28, 0x48, 0x1A, 0x8B, 0x42, 0x92, 
-0x00, 0xA6, 0xA8, 0x95, 0x3C, 0x1E, 0x8F, 0xBF, 0xB0, 0x2B, 0x91, 0x89, 0xCB, 0x4C, 0xE4, 0xE1, 
-0x22, 0x55, 0xCB, 0x6A, 0x16, 0xA6, 0x62, 0x9C, 0xDB, 0x45, 0x81, 0x59, 0x14, 0xE0, 0xA2, 0x34, 
-0x0E, 0xE6, 0xA2, 0x50, 0x63, 0xCD, 0x20, 0x44, 0x09, 0x24, 0x08, 0x40, 0x88, 0x91, 0x45, 0xC8, 
-0xC9, 0x92, 0xB3, 0x04, 0x1F, 0xE0, 0x31, 0x4B, 0x8B, 0x4B, 0x52, 0xF2, 0x2C, 0xA2, 0x52, 0xAD, 
-0x33, 0x2E, 0x97, 0x9C, 0x2B, 0x4A, 0x10, 0x5A, 0x44, 0x15, 0xBF, 0x51, 0xE3, 0x58, 0x4A, 0x4A, 
-0x96, 0x25, 0x9F, 0x47, 0xD4, 0x01, 0x89, 0x93, 0x22, 0x2C, 0xD9, 0x35, 0x80, 0x08, 0x63, 0x91, 
-0x8F, 0x3F, 0x14, 0x92, 0x17, 0xFF, 0x79, 0xEB, 0xBE, 0x83, 0x24, 0x95, 0x6A, 0xFC, 0x2C, 0x9C, 
-0x84, 0x93, 0x60, 0xC6, 0x15, 0x0B, 0x8F, 0x90, 0xC7, 0x58, 0xE0, 0x68, 0x95, 0x86, 0xC8, 0xEF, 
-0x87, 0xC8, 0x0E, 0xE0, 0x29, 0x80, 0x35, 0x2B, 0x51, 0xF0, 0x42, 0x49, 0x03, 0x84, 0x18, 0x24, 
-0x32, 0x2E, 0xD3, 0x95, 0x22, 0xB2, 0x8C, 0xBF, 0x41, 0xD2, 0xE7, 0x66, 0x93, 0x9F, 0x81, 0xF5, 
-0xC9, 0xD8, 0x70, 0x3D, 0xDD, 0xB1, 0x32, 0x70, 0x8F, 0xDD, 0xDD, 0x19, 0x4D, 0xE0, 0x07, 0x84, 
-0x14, 0x0A, 0x80, 0x91, 0xAF, 0x35, 0x89, 0x10, 0x10, 0xB2, 0xCA, 0xD8, 0xFA, 0x98, 0xCC, 0x33, 
-0x7E, 0x33, 0xF5, 0x06, 0xAE, 0xD3, 0x44, 0x2D, 0x8F, 0xC9, 0xE1, 0x64, 0xF2, 0xAF, 0x29, 0xA9, 
-0xE9, 0xB7, 0x3B, 0x0D, 0xBB, 0x99, 0xB8, 0x69, 0xB1, 0xAA, 0xD7, 0x1C, 0x4D, 0x56, 0x2D, 0x56, 
-0xFE, 0xA2, 0x52, 0x5C, 0xB7, 0x16, 0xA1, 0x58, 0xD8, 0x69, 0xC9, 0x63, 0x95, 0x8A, 0xE2, 0x98, 
-0xC0, 0xF8, 0xB4, 0x33, 0x4C, 0x00, 0xC5, 0xF4, 0x21, 0x90, 0x59, 0xA6, 0xFD, 0x53, 0xF1, 0x5C, 
-0x1E, 0x93, 0x18, 0x76, 0xCA, 0xCB, 0x69, 0x2F, 0xF2, 0xB4, 0x58, 0x55, 0x6A, 0x13, 0xC6, 0x02, 
-0x84, 0x77, 0x64, 0xE5, 0xAC, 0x5C, 0xA4, 0x45, 0x30, 0x13, 0x4A, 0x89, 0x1C, 0xB5, 0xD1, 0xDE, 
-0x99, 0x1D, 0x2E, 0xD3, 0xC5, 0x52, 0x99, 0xD1, 0x7E, 0x4D, 0x55, 0xB0, 0xBC, 0x38, 0x24, 0x5F, 
-0x9B, 0x95, 0xBD, 0x9A, 0xEE, 0x65, 0xDE, 0x92, 0xDD, 0xC3, 0xC0, 0x17, 0x84, 0x56, 0x6F, 0xED, 
-0x4B, 0x5C, 0xF1, 0x72, 0x9E, 0xC1, 0xB6, 0xC0, 0x53, 0x44, 0x96, 0xB5, 0x54, 0x0B, 0xDE, 0x10, 
-0xCC, 0x59, 0x9E, 0x66, 0xA0, 0xCA, 0x5C, 0x14, 0x42, 0xAE, 0x58, 0xCC, 0xFD, 0x19, 0x33, 0x16, 
-0x5F, 0x82, 0x4E, 0xAA, 0x22, 0x01, 0xAF, 0xCE, 0x44, 0x79, 0x4C, 0xF6, 0x5E, 0xFF, 0x8A, 0x3F, 
-0x5B, 0xFD, 0xA4, 0xB5, 0xAF, 0x25, 0x37, 0x6A, 0xF9, 0xF7, 0xC4, 0x43, 0xDE, 0xC0, 0xF6, 0xDE, 
-0xC1, 0x91, 0xD1, 0x75, 0x75, 0xE4, 0x18, 0xBB, 0xD0, 0x81, 0x2F, 0x33, 0x91, 0xAC, 0xED, 0x51, 
-0x4E, 0xD2, 0x2B, 0xA2, 0x67, 0x45, 0x74, 0xC5, 0x92, 0x24, 0x2D, 0x16, 0xC7, 0xE4, 0x99, 0x66, 
-0x6C, 0x11, 0xE4, 0xEC, 0x26, 0x30, 0x04, 0x27, 0xF8, 0xC8, 0x0A, 0xAE, 0xCF, 0x80, 0x66, 0x12, 
-0x67, 0x4C, 0xCA, 0x88, 0xBA, 0xC3, 0x00, 0x36, 0xA7, 0xE4, 0xD4, 0x83, 0x7D, 0x62, 0xBC, 0x23, 
-0x4D, 0xA2, 0x41, 0x9A, 0xBC, 0xE7, 0x52, 0xB2, 0x05, 0x1F, 0x78, 0xA7, 0x8A, 0x3A, 0x0E, 0xF8, 
-0x12, 0xD8, 0xC9, 0xF8, 0x9B, 0x12, 0x70, 0xCB, 0x98, 0x2F, 0x45, 0x96, 0xF0, 0x32, 0xA2, 0x1F, 
-0x31, 0xF8, 0xB2, 0x62, 0x4D, 0x72, 0xC3, 0x83, 0x92, 0x2B, 0x96, 0x55, 0xC0, 0xA4, 0x23, 0xCE, 
-0x38, 0x07, 0xCA, 0xA3, 0x69, 0x72, 0xC1, 0x8B, 0xA4, 0x16, 0x60, 0x47, 0xCC, 0x57, 0x10, 0xB8, 
-0x40, 0x6C, 0x09, 0x87, 0x94, 0x88, 0x22, 0xCE, 0xD2, 0xF8, 0x32, 0xCA, 0xD7, 0xAF, 0x54, 0x31, 
-0x1C, 0x9D, 0xE2, 0xEA, 0x93, 0xB1, 0x19, 0xAE, 0xF7, 0x3C, 0x86, 0x4D, 0xDF, 0xA1, 0x00, 0x2F, 
-0x40, 0x9C, 0xE0, 0x8E, 0x58, 0xC9, 0x99, 0xDE, 0xBC, 0x85, 0x2D, 0x07, 0xA8, 0x22, 0x98, 0xFF, 
-0x9C, 0xD6, 0xFA, 0x17, 0x32, 0xB5, 0xA7, 0x95, 0x67, 0x4C, 0xA5, 0x57, 0x7C, 0x4A, 0xE1, 0x91, 
-0x25, 0xA2, 0xC8, 0xD6, 0xD1, 0xC0, 0x3D, 0x0D, 0x7C, 0x45, 0x69, 0xB6, 0x46, 0x7D, 0x2D, 0x2D, 
-0x7D, 0x62, 0xC0, 0xAA, 0x58, 0x80, 0x37, 0x96, 0x24, 0x61, 0x8A, 0x91, 0x30, 0x0C, 0x31, 0xB2, 
-0xB9, 0x35, 0x0E, 0x5D, 0x03, 0x12, 0x22, 0x60, 0x20, 0x57, 0x9C, 0x27, 0x10, 0x36, 0x40, 0x19, 
-0xA8, 0xB7, 0xB7, 0xE7, 0xF8, 0x48, 0x49, 0x1D, 0x47, 0x22, 0x9A, 0xF1, 0xB9, 0xEA, 0x01, 0xCC, 
-0x66, 0x52, 0x64, 0x95, 0xE2, 0x53, 0xA2, 0xC4, 0xEA, 0x98, 0xFC, 0x8C, 0x0E, 0xE2, 0x4E, 0xEF, 
-0x11, 0x3C, 0x0B, 0x38, 0x03, 0xA9, 0x82, 0x03, 0x31, 0x09, 0x8F, 0xA6, 0xF6, 0x04, 0x5A, 0x3F, 
-0xFB, 0x02, 0xB6, 0x4E, 0xF8, 0xCD, 0x31, 0x79, 0x31, 0xF5, 0x35, 0x7F, 0x0E, 0x92, 0x41, 0xF5, 
-0xBE, 0x45, 0x11, 0x21, 0x66, 0x46, 0x8B, 0x2D, 0x87, 0x80, 0x4D, 0x75, 0xAE, 0x8D, 0x68, 0x9E, 
-0x04, 0xFA, 0x15, 0x76, 0xE8, 0x66, 0x6D, 0x2C, 0x6D, 0x36, 0xA7, 0x63, 0x59, 0xCB, 0x5B, 0x36, 
-0xB9, 0x27, 0x7C, 0x56, 0x2D, 0x3C, 0xF6, 0xFA, 0xCD, 0xC1, 0xA3, 0x80, 0x0F, 0xC7, 0x87, 0x03, 
-0x55, 0x56, 0x7C, 0x30, 0xDA, 0x2A, 0x77, 0xDC, 0x23, 0xF8, 0x1B, 0x81, 0x65, 0x22, 0xBE, 0xF4, 
-0x70, 0xE1, 0x6B, 0x20, 0x2A, 0x05, 0x29, 0x99, 0xB7, 0x00, 0xBE, 0x83, 0x81, 0xE1, 0x3F, 0x8A, 
-0x4C, 0xA5, 0x39, 0xF7, 0x90, 0x99, 0x57, 0x0F, 0xD1, 0x47, 0x20, 0xFC, 0x08, 0x8D, 0x25, 0x3C, 
-0xE3, 0xCA, 0x47, 0xE6, 0x08, 0x2D, 0x73, 0x22, 0xE9, 0x9F, 0xD5, 0x57, 0xC9, 0x25, 0x96, 0x4D, 
-0x35, 0xAC, 0x92, 0x63, 0xFE, 0xA5, 0xC4, 0xC7, 0xF5, 0x17, 0xCE, 0x79, 0x32, 0xAC, 0xEE, 0xF0, 
-0x29, 0x12, 0x5B, 0x01, 0xCC, 0x25, 0x8A, 0x3A, 0x98, 0xED, 0xD4, 0x48, 0x59, 0xC6, 0x4B, 0xA5, 
-0x97, 0x89, 0x85, 0x46, 0xEC, 0xB4, 0x64, 0x69, 0x14, 0xB2, 0x5B, 0x92, 0xCE, 0x53, 0x0C, 0x37, 
-0x2E, 0x86, 0xF6, 0xA6, 0x04, 0x9F, 0x11, 0x78, 0x85, 0xCA, 0x38, 0x3D, 0x3D, 0x13, 0xC5, 0x3C, 
-0x2D, 0x61, 0x19, 0x84, 0x8F, 0xAD, 0xA1, 0xB4, 0xB5, 0x70, 0x33, 0xAE, 0xBE, 0x2C, 0x39, 0x59, 
-0x8B, 0x8A, 0xC8, 0x0A, 0x1E, 0x94, 0x20, 0xC6, 0xAC, 0xE4, 0xBE, 0x00, 0xDD, 0xE2, 0x3A, 0x17, 
-0x02, 0x90, 0xFB, 0xC1, 0xDA, 0x66, 0x87, 0xBE, 0xC9, 0x66, 0xC8, 0xF3, 0x9B, 0x65, 0x9A, 0xF0, 
-0x97, 0x38, 0xE3, 0x5C, 0x4F, 0x18, 0x0E, 0xFE, 0x80, 0x12, 0x15, 0x9D, 0xFB, 0x8C, 0x15, 0x31, 
-0xCF, 0xEA, 0x9C, 0xE1, 0xC7, 0xD9, 0x6F, 0xE2, 0xFF, 0x4E, 0x2C, 0x24, 0xF2, 0xC7, 0xEF, 0xEF, 
-0xCF, 0xFD, 0xAC, 0x64, 0x72, 0xA9, 0xF9, 0x9B, 0xA7, 0x4D, 0x09, 0x9E, 0x52, 0x8D, 0x6F, 0xF9, 
-0x12, 0x4C, 0xBD, 0xBC, 0xCD, 0x77, 0xB4, 0x27, 0xFF, 0xBF, 0xBA, 0x8E, 0x06, 0xF7, 0x43, 0x3D, 
-0x47, 0x23, 0x40, 0xD5, 0xEB, 0x87, 0xBF, 0xC1, 0xB6, 0xDA, 0x23, 0xEF, 0xF2, 0xCD, 0xFB, 0x6D, 
-0xAB, 0xEB, 0x48, 0x53, 0x3B, 0x42, 0x3D, 0xA9, 0x7B, 0xD2, 0x1D, 0xD7, 0x81, 0x79, 0xED, 0xD1, 
-0x67, 0x76, 0xC5, 0x0C, 0x55, 0x6B, 0x07, 0x7B, 0x59, 0x91, 0xF1, 0x10, 0x61, 0x50, 0xB1, 0xE2, 
-0x05, 0x1D, 0x4D, 0x91, 0xDB, 0x15, 0x2B, 0xC9, 0xB5, 0x24, 0x11, 0x29, 0x2A, 0x53, 0x41, 0x23, 
-0x41, 0x42, 0x75, 0xA2, 0x30, 0x51, 0x74, 0xE8, 0xC0, 0xA4, 0x80, 0x1A, 0x84, 0x27, 0x40, 0x9F, 
-0xB3, 0x4C, 0xF2, 0x9A, 0x05, 0xE6, 0xFD, 0x86, 0x68, 0x68, 0x3A, 0x79, 0x77, 0x89, 0xCA, 0x70, 
-0xC5, 0xFC, 0xA3, 0x3B, 0x2F, 0xA4, 0x61, 0xF6, 0x74, 0x34, 0x64, 0x38, 0xAF, 0x0A, 0x5D, 0xE8, 
-0x90, 0x05, 0xD7, 0x28, 0x86, 0x23, 0x5B, 0xF6, 0xE3, 0x26, 0x14, 0xF9, 0xC2, 0x4B, 0xF1, 0x27, 
-0x43, 0x0C, 0xC3, 0xA2, 0xCA, 0x0F, 0x4C, 0xC9, 0x25, 0x47, 0x24, 0x3A, 0x25, 0x17, 0xAA, 0x84, 
-0x7A, 0x0B, 0xC9, 0xA3, 0x10, 0x0A, 0xE9, 0x0B, 0xDC, 0xC7, 0xD0, 0x8C, 0x1F, 0x90, 0xC1, 0x64, 
-0x30, 0x32, 0xED, 0x84, 0x06, 0x22, 0x12, 0xB6, 0xC6, 0xFD, 0xF1, 0x6B, 0x72, 0xCE, 0x30, 0xEB, 
-0x4C, 0xEB, 0xB1, 0x25, 0xD0, 0xAD, 0x94, 0xA1, 0x9E, 0x17, 0x02, 0x92, 0xDF, 0x45, 0x55, 0xCA, 
-0xE1, 0xE8, 0xE0, 0x99, 0x37, 0x31, 0xEF, 0x9B, 0xF8, 0x3E, 0x2D, 0xA0, 0x08, 0xEB, 0x4E, 0x95, 
-0x7D, 0x53, 0x2F, 0x38, 0x6C, 0x29, 0x69, 0xA6, 0xEA, 0xD9, 0x25, 0x57, 0x55, 0x59, 0x90, 0xE5, 
-0xFE, 0xE0, 0x78, 0xB0, 0x9F, 0xEB, 0xDF, 0x72, 0x7F, 0x40, 0x02, 0x32, 0x98, 0xBA, 0xE4, 0x70, 
-0xDB, 0x52, 0x53, 0xCE, 0x0A, 0xA8, 0x65, 0x3F, 0xF1, 0xD9, 0x05, 0x28, 0x12, 0x13, 0x15, 0xA8, 
-0x4B, 0xCF, 0x34, 0x86, 0x85, 0x0D, 0x36, 0x63, 0xF4, 0x1A, 0x9B, 0x73, 0x4A, 0xF6, 0x49, 0x22, 
-0xE2, 0x0A, 0xCC, 0xA6, 0xC0, 0x25, 0x62, 0x7D, 0x8C, 0xC3, 0xA5, 0x00, 0xED, 0xEE, 0x13, 0x3A, 
-0xBE, 0xE6, 0x33, 0xA9, 0xC3, 0xC1, 0xB5, 0x44, 0x37, 0x19, 0x8F, 0xEF, 0x64, 0x76, 0xF8, 0xE2, 
-0x59, 0x78, 0xF8, 0xF3, 0xAF, 0xE1, 0x61, 0x08, 0x7D, 0x52, 0x77, 0xAD, 0xC5, 0x11, 0x42, 0x0B, 
-0x06, 0x4E, 0x87, 0xDE, 0x60, 0x51, 0xD7, 0x46, 0x25, 0x0D, 0x12, 0xD0, 0xC8, 0xEB, 0x8C, 0xE3, 
-0xE3, 0xAB, 0xF5, 0xDB, 0x64, 0xD8, 0x54, 0xE9, 0xA3, 0x50, 0xB7, 0x17, 0x64, 0x3F, 0xF2, 0x7C, 
-0x02, 0x90, 0x7E, 0x7A, 0x7F, 0xF1, 0x1B, 0x28, 0xE6, 0xAC, 0xF6, 0x4B, 0x28, 0xB0, 0xFF, 0x5B, 
-0x50, 0xD7, 0xC2, 0xF9, 0xFE, 0x6A, 0x3C, 0x8E, 0xD4, 0xD9, 0xF5, 0xD6, 0xC7, 0x16, 0x67, 0x42, 
-0x72, 0x1F, 0x1C, 0xBF, 0x02, 0x10, 0xDF, 0x11, 0xE1, 0x79, 0x2A, 0xE3, 0x0D, 0x90, 0x96, 0x79, 
-0xEB, 0xF8, 0x75, 0x61, 0xD7, 0x87, 0x07, 0x3F, 0xD2, 0x70, 0x86, 0x42, 0x73, 0xD8, 0xB1, 0xF9, 
-0x01, 0xF6, 0x83, 0xA3, 0x56, 0x1F, 0x7A, 0xAB, 0xDF, 0xBC, 0x4D, 0x5A, 0xAC, 0xBD, 0xDB, 0xB4, 
-0x02, 0xD2, 0x39, 0x31, 0xB4, 0x50, 0xB7, 0x2B, 0x51, 0x44, 0xE8, 0x1E, 0x4A, 0xFC, 0xF0, 0x07, 
-0x1D, 0x79, 0xAD, 0xB7, 0x7F, 0x88, 0x6B, 0xA2, 0x2B, 0x2D, 0x35, 0xE2, 0xC1, 0xA8, 0x19, 0x30, 
-0xFE, 0x6C, 0x5F, 0x6F, 0xC9, 0x5D, 0xB2, 0x74, 0x3D, 0xDF, 0x11, 0xE6, 0xC2, 0x48, 0x57, 0x9A, 
-0xA9, 0xFD, 0x37, 0xE4, 0x4C, 0x37, 0x04, 0x3D, 0xCA, 0x78, 0x0D, 0xA2, 0xA9, 0x0F, 0x74, 0x17, 
-0x63, 0x54, 0x0B, 0xD5, 0x03, 0x98, 0x9A, 0x6B, 0x89, 0x8F, 0x62, 0x05, 0xE8, 0x1F, 0x3E, 0xFF, 
-0x77, 0xDD, 0xE0, 0x7B, 0xDB, 0xF0, 0xBD, 0x15, 0x3C, 0xE0, 0x2D, 0x5E, 0xFD, 0x00, 0xDE, 0x21, 
-0x19, 0xEA, 0x98, 0xF7, 0xD5, 0x83, 0x39, 0x04, 0x5F, 0xDA, 0x35, 0xCE, 0x34, 0x22, 0x3F, 0xFD, 
-0x44, 0xE0, 0x3D, 0xC4, 0x8E, 0x75, 0x0D, 0x91, 0x10, 0x8A, 0x32, 0xD0, 0xF1, 0xE1, 0xC8, 0xDF, 
-0x05, 0x0C, 0x4B, 0x68, 0xAB, 0x87, 0x83, 0x81, 0xF6, 0x1D, 0x38, 0xE8, 0x4B, 0x0E, 0x21, 0x93, 
-0xCC, 0x38, 0x53, 0x0E, 0x80, 0x91, 0xAF, 0x1D, 0x0C, 0x3D, 0x6C, 0x47, 0x83, 0xB1, 0x9E, 0x55, 
-0x77, 0x60, 0x9E, 0xD1, 0x7B, 0xFC, 0xC0, 0xF5, 0x41, 0xF8, 0xBC, 0x4D, 0x11, 0x75, 0x29, 0x8E, 
-0x91, 0xBB, 0x04, 0xAA, 0x1D, 0x0C, 0x75, 0x9B, 0x1B, 0x36, 0xD7, 0x35, 0x67, 0x78, 0x5B, 0x13, 
-0xD1, 0xBD, 0x57, 0xCF, 0x7F, 0x99, 0xBC, 0x79, 0x63, 0x8E, 0xD1, 0x46, 0x04, 0xD4, 0xD4, 0xAD, 
-0x3A, 0x6F, 0xAE, 0x3E, 0x46, 0x21, 0x4B, 0x92, 0xD7, 0x68, 0xF3, 0x77, 0xA9, 0x84, 0xF2, 0x84, 
-0x97, 0xC3, 0xC1, 0x25, 0x5F, 0x57, 0xAB, 0xC1, 0xC1, 0x96, 0x60, 0xD0, 0xB8, 0x2D, 0xCC, 0x3B, 
-0x13, 0x09, 0x6A, 0x15, 0xD4, 0xFA, 0xBC, 0x56, 0xAB, 0x19, 0x5C, 0x95, 0xFA, 0xFB, 0x9C, 0xCF, 
-0x59, 0x95, 0xA9, 0xDA, 0x4D, 0xED, 0x65, 0x86, 0x79, 0x43, 0xD5, 0xDE, 0xDE, 0x03, 0xD5, 0x74, 
-0xFF, 0xBD, 0x38, 0x75, 0x91, 0xB1, 0x15, 0xA7, 0xE6, 0x8E, 0xCC, 0xDB, 0xA9, 0xC2, 0xC8, 0xF7, 
-0xF6, 0x52, 0x07, 0x9B, 0x51, 0xED, 0x0D, 0x0F, 0xD2, 0x9B, 0x3E, 0x31, 0x7A, 0x23, 0xE8, 0x9B, 
-0x6D, 0x19, 0xE6, 0xDA, 0xC0, 0x0A, 0xB1, 0xA5, 0xC1, 0x2E, 0x7E, 0x4F, 0xEB, 0x34, 0xEE, 0x6A, 
-0x11, 0xA4, 0x5A, 0x75, 0x20, 0x1A, 0xFD, 0x7A, 0x6F, 0xD8, 0x75, 0xF7, 0x0E, 0x70, 0x64, 0xB8, 
-0x7A, 0xA9, 0x20, 0xE9, 0x43, 0x19, 0xC5, 0x87, 0x14, 0x1B, 0x33, 0x7A, 0x80, 0x5D, 0x9C, 0x0E, 
-0xE8, 0x10, 0x46, 0xA6, 0xF7, 0x73, 0xD2, 0xB7, 0x2B, 0x23, 0xEB, 0x66, 0xF6, 0x8A, 0x24, 0xA2, 
-0x87, 0xE1, 0x84, 0xD6, 0x46, 0x02, 0xA3, 0x82, 0x2F, 0x7F, 0x07, 0x58, 0x66, 0xF8, 0xE9, 0xA8, 
-0x26, 0xE1, 0x51, 0x83, 0x0A, 0xFE, 0x75, 0xD4, 0xAE, 0xCF, 0x62, 0x5A, 0xE0, 0x2D, 0x84, 0x6F, 
-0x62, 0x43, 0x01, 0x37, 0xB5, 0x6D, 0x7F, 0x13, 0x53, 0x77, 0xF5, 0xC3, 0xA6, 0x55, 0xE8, 0x87, 
-0x82, 0x68, 0x6E, 0x74, 0x5F, 0xCF, 0x70, 0x89, 0x1C, 0xB9, 0x99, 0xB5, 0x0F, 0x32, 0x92, 0xB9, 
-0xBE, 0x79, 0xE8, 0x81, 0x7E, 0xFE, 0xFC, 0xC5, 0x8B, 0xF9, 0xBC, 0x4E, 0xDE, 0xBD, 0xC8, 0xD1, 
-0x3F, 0xCF, 0x72, 0x60, 0x5E, 0x67, 0x8A, 0xE9, 0x13, 0xAC, 0xF4, 0x28, 0x5C, 0x8B, 0x92, 0xAD, 
-0x1F, 0x05, 0x0A, 0x82, 0x92, 0x7F, 0xC0, 0x3B, 0x67, 0x43, 0x07, 0xC7, 0x07, 0xD8, 0xC8, 0xE6, 
-0xD8, 0x5D, 0xFC, 0xEE, 0x37, 0x10, 0x72, 0xA2, 0xFB, 0x38, 0xEE, 0x9B, 0x47, 0xAF, 0x7B, 0x90, 
-0x75, 0xF4, 0xD5, 0xD0, 0xDF, 0x62, 0x1C, 0x57, 0x32, 0xB4, 0xEA, 0xAD, 0x47, 0x59, 0xE8, 0x31, 
-0xD8, 0x1E, 0x61, 0x20, 0x0D, 0x4C, 0xDB, 0x87, 0x78, 0x9F, 0x06, 0x5F, 0xD7, 0x58, 0xEE, 0x42, 
-0xCA, 0xEB, 0x3F, 0xDA, 0x47, 0x44, 0x5F, 0x61, 0x59, 0x6B, 0xBB, 0xED, 0x58, 0x24, 0x9B, 0x99, 
-0xBE, 0x7D, 0x73, 0x03, 0xCD, 0x88, 0x9D, 0x28, 0x97, 0xE2, 0xDA, 0xE4, 0x84, 0xAE, 0x7C, 0x7B, 
-0xF1, 0xB4, 0x45, 0xFC, 0x5F, 0x26, 0x5F, 0x3E, 0x54, 0xBA, 0xDF, 0xFB, 0x6F, 0x11, 0xEE, 0x4B, 
-0xEF, 0x36, 0xAF, 0x60, 0x0B, 0x96, 0x3B, 0x28, 0x4F, 0xDE, 0x2B, 0x72, 0x1D, 0x3A, 0x7F, 0x7D, 
-0x2A, 0x66, 0xC7, 0xA4, 0x36, 0x1E, 0x5A, 0x5D, 0xE3, 0x8B, 0x22, 0x8A, 0xB7, 0x32, 0x10, 0x63, 
-0xB7, 0x3A, 0x97, 0x2B, 0xB8, 0xA8, 0xAB, 0xFA, 0xA0, 0xF0, 0xB4, 0xEE, 0xE3, 0xFC, 0xC4, 0x6C, 
-0xD5, 0xE5, 0x36, 0x4F, 0x27, 0xED, 0x09, 0xFD, 0x59, 0xD4, 0xAF, 0xC7, 0x1C, 0x26, 0x73, 0x93, 
-0x03, 0xA8, 0x88, 0x57, 0x73, 0xED, 0x9D, 0x65, 0x9C, 0x15, 0x7A, 0x68, 0xAF, 0xA9, 0x97, 0xFD, 
-0x65, 0x4D, 0x39, 0xEC, 0x2F, 0xB3, 0xD4, 0x3B, 0xD7, 0xA0, 0x8F, 0x6F, 0xAE, 0x79, 0xF3, 0x66, 
-0xCB, 0xA2, 0xBA, 0xC6, 0x6F, 0x09, 0x32, 0xD4, 0xBB, 0x96, 0x18, 0x31, 0xDD, 0x25, 0x56, 0x4C, 
-0xCF, 0x22, 0xEB, 0xB1, 0x48, 0xF6, 0xFE, 0x90, 0xD7, 0x2C, 0xD7, 0xE3, 0x7B, 0x7E, 0xF3, 0xB0, 
-0x79, 0x8B, 0x60, 0x3F, 0x36, 0x3E, 0x76, 0xC9, 0x7D, 0x15, 0x69, 0x3D, 0xD4, 0xDB, 0xA0, 0xB8, 
-0x46, 0xE1, 0xB6, 0xA7, 0xB1, 0xB6, 0x75, 0xAB, 0x05, 0x6B, 0xEF, 0x29, 0x74, 0x2F, 0xD0, 0x1F, 
-0x92, 0x71, 0x3A, 0xDD, 0xD7, 0xBD, 0x82, 0x17, 0x92, 0xDB, 0xBD, 0xC3, 0x1D, 0x51, 0x4F, 0xFF, 
-0x55, 0xE1, 0x89, 0x11, 0xF9, 0x7E, 0xB6, 0xDB, 0x8A, 0x92, 0xD6, 0x1F, 0x2F, 0x5C, 0x71, 0xF2, 
-0xB8, 0x70, 0xFD, 0x18, 0xE0, 0xAD, 0x70, 0xFD, 0xAD, 0xA8, 0xF5, 0x45, 0x96, 0x07, 0x19, 0xEC, 
-0x57, 0xFF, 0xC7, 0x81, 0xFF, 0x01, 0x10, 0x89, 0x66, 0xF2, 0x26, 0x22, 0x00, 0x00
+0x1F, 0x8B, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x03, 0xB5, 0x5A, 0x6D, 0x73, 0xDB, 0x36, 
+0x12, 0xFE, 0x9E, 0x5F, 0x81, 0xD0, 0x77, 0x15, 0x75, 0x96, 0x29, 0x39, 0x69, 0x92, 0xD6, 0x7A, 
+0xC9, 0xA4, 0x8E, 0xDD, 0xE6, 0x26, 0x76, 0x6E, 0xEC, 0xDC, 0xE4, 0x66, 0x12, 0xDF, 0x0D, 0x44, 
+0x42, 0x12, 0x12, 0x8A, 0x50, 0x09, 0xC8, 0x8A, 0x9A, 0xE6, 0xBF, 0xDF, 0xEE, 0x02, 0x20, 0x41, 
+0xBD, 0x35, 0xBD, 0x99, 0x4B, 0x27, 0x11, 0x08, 0xEC, 0x2E, 0x16, 0xBB, 0x8B, 0xDD, 0x07, 0x40, 
+0x07, 0x0F, 0x33, 0x95, 0x9A, 0xF5, 0x42, 0xB0, 0x99, 0x99, 0xE7, 0xA3, 0x07, 0x03, 0xFB, 0xC3, 
+0xD8, 0x60, 0x26, 0x78, 0x86, 0x0D, 0x68, 0xCE, 0x85, 0xE1, 0x2C, 0x9D, 0xF1, 0x52, 0x0B, 0x33, 
+0x8C, 0x96, 0x66, 0x72, 0xF2, 0x43, 0x14, 0x0E, 0x15, 0x7C, 0x2E, 0x86, 0xD1, 0xBD, 0x14, 0xAB, 
+0x85, 0x2A, 0x4D, 0xC4, 0x52, 0x55, 0x18, 0x51, 0x00, 0xE9, 0x4A, 0x66, 0x66, 0x36, 0xCC, 0xC4, 
+0xBD, 0x4C, 0xC5, 0x09, 0x7D, 0x74, 0x98, 0x2C, 0xA4, 0x91, 0x3C, 0x3F, 0xD1, 0x29, 0xCF, 0xC5, 
+0xF0, 0xD4, 0x0B, 0x32, 0xD2, 0xE4, 0x62, 0xF4, 0x4E, 0x8C, 0x6F, 0x45, 0x09, 0xC3, 0x83, 0xAE, 
+0xED, 0xB0, 0x83, 0xDA, 0xAC, 0x73, 0xC1, 0x50, 0xCD, 0x61, 0x64, 0xC4, 0x67, 0xD3, 0x4D, 0xB5, 
+0x76, 0x8C, 0x8C, 0x8D, 0x55, 0xB6, 0xB6, 0xAD, 0x2F, 0x6C, 0xCE, 0xCB, 0xA9, 0x2C, 0xCE, 0x58, 
+0xAF, 0xCF, 0x26, 0xA0, 0xC4, 0xC9, 0x84, 0xCF, 0x65, 0xBE, 0x3E, 0x63, 0x9A, 0x17, 0xFA, 0x44, 
+0x83, 0xE4, 0x49, 0x9F, 0x7D, 0x75, 0x7C, 0xC9, 0x98, 0x97, 0x9E, 0x2F, 0x93, 0x7A, 0x91, 0x73, 
+0x20, 0x9C, 0xE4, 0xE2, 0x73, 0x9F, 0x4D, 0xF9, 0xE2, 0x8C, 0x3D, 0x5D, 0x40, 0x6B, 0xC1, 0xB3, 
+0x4C, 0x16, 0xD3, 0x33, 0x76, 0xDA, 0xC3, 0x4F, 0x1C, 0x3E, 0x59, 0x95, 0x38, 0x8C, 0xFF, 0x6E, 
+0x08, 0x93, 0xC5, 0x62, 0x69, 0xBE, 0x10, 0x11, 0x30, 0xF4, 0xD9, 0x5C, 0x16, 0x76, 0xD5, 0xF0, 
+0xF5, 0xA4, 0xD7, 0x10, 0x47, 0xC2, 0x3D, 0xF3, 0x78, 0x69, 0x8C, 0x2A, 0xAC, 0x26, 0x21, 0x85, 
+0x9B, 0x74, 0xAC, 0xCA, 0x4C, 0x94, 0xB4, 0x28, 0xDB, 0x3C, 0x29, 0x79, 0x26, 0x97, 0xFA, 0x8C, 
+0x3D, 0xC6, 0xE1, 0x54, 0xE5, 0x0A, 0x46, 0x57, 0x33, 0x69, 0x04, 0x50, 0xF0, 0xF4, 0xD3, 0xB4, 
+0x54, 0xCB, 0x22, 0x3B, 0x63, 0xD3, 0x92, 0xAF, 0x61, 0x7C, 0x59, 0x6A, 0x24, 0x58, 0x28, 0x09, 
+0x6E, 0x29, 0x37, 0xA7, 0x4D, 0x60, 0xE6, 0x2F, 0x0D, 0xB6, 0xA3, 0xC7, 0x8F, 0x7F, 0xFC, 0x71, 
+0x12, 0x58, 0xEA, 0x48, 0x8B, 0x22, 0x73, 0x96, 0x3A, 0x4C, 0x58, 0x0A, 0x08, 0x91, 0x1D, 0x84, 
+0x3F, 0x3D, 0x7E, 0xD6, 0xBB, 0xBC, 0x0C, 0x08, 0x31, 0x58, 0x9C, 0xC4, 0x85, 0xD2, 0x10, 0x11, 
+0x0A, 0xBC, 0x56, 0x8A, 0x9C, 0x1B, 0x79, 0x0F, 0xAB, 0x50, 0xF7, 0xA2, 0x9C, 0xE4, 0x6A, 0x75, 
+0x02, 0x2E, 0xE1, 0x4B, 0xA3, 0xFA, 0x6C, 0x26, 0xE4, 0x74, 0x66, 0xCE, 0x18, 0x44, 0x4D, 0x1A, 
+0x9F, 0xF6, 0x7A, 0xF7, 0x33, 0x76, 0xC2, 0x9E, 0x82, 0x7D, 0xDA, 0xFD, 0xDA, 0xEB, 0xD6, 0x60, 
+0x6E, 0x8E, 0xF0, 0x4F, 0x43, 0x99, 0x8B, 0x1F, 0xF0, 0xBF, 0x8D, 0x08, 0x99, 0xAB, 0x42, 0xE9, 
+0x05, 0x4F, 0x85, 0xEB, 0xD7, 0xF2, 0x37, 0x01, 0x6E, 0x7B, 0x1C, 0xFA, 0xE9, 0x88, 0x08, 0xCA, 
+0x0D, 0xAD, 0xF9, 0x58, 0xAB, 0x7C, 0x89, 0xB6, 0x37, 0x6A, 0x41, 0x5E, 0xCA, 0xC5, 0xC4, 0x50, 
+0xC3, 0x3B, 0xBF, 0x21, 0xA4, 0x54, 0x2B, 0xBD, 0xB5, 0xF4, 0x5A, 0x48, 0xC5, 0x5C, 0xDA, 0x05, 
+0xF7, 0x82, 0xA8, 0xE9, 0xB1, 0xEF, 0xB7, 0x45, 0x65, 0xF2, 0x1E, 0x44, 0x79, 0xFB, 0x9C, 0x52, 
+0x64, 0xE5, 0xB2, 0x10, 0x27, 0xCD, 0x2E, 0x8A, 0x8F, 0x13, 0x5A, 0x01, 0xC4, 0x42, 0x29, 0x82, 
+0xD8, 0xCD, 0x7B, 0x9D, 0x24, 0x3F, 0x85, 0xBF, 0x8F, 0x40, 0xD0, 0xFE, 0x70, 0x3A, 0x4A, 0x7B, 
+0xBD, 0x90, 0xEB, 0x31, 0xF3, 0xDB, 0xC7, 0xF1, 0x6C, 0x12, 0x7C, 0xBF, 0x45, 0x30, 0x7E, 0xDA, 
+0x20, 0x78, 0xB2, 0x45, 0xD0, 0x6B, 0x12, 0x3C, 0xDD, 0x24, 0x18, 0xE7, 0xA0, 0x50, 0x48, 0xF1, 
+0x6C, 0x4B, 0xC4, 0xB3, 0x67, 0xCF, 0x42, 0x82, 0xCF, 0xDB, 0x73, 0xF4, 0x78, 0x4D, 0x90, 0x41, 
+0xB2, 0x51, 0x53, 0xA6, 0x45, 0x2E, 0x52, 0x13, 0x64, 0x90, 0xC0, 0xD0, 0x83, 0x2E, 0xE5, 0x1F, 
+0xCA, 0x8A, 0x5D, 0x9B, 0x16, 0xB1, 0x89, 0x79, 0xC7, 0xE5, 0x27, 0x74, 0x41, 0x9A, 0x73, 0xAD, 
+0x87, 0x11, 0xE4, 0x81, 0x2A, 0x33, 0x0D, 0x28, 0x21, 0x30, 0x99, 0x0D, 0xA3, 0xB9, 0x9E, 0x46, 
+0x41, 0x02, 0x8B, 0x18, 0xA4, 0x9B, 0x54, 0xCC, 0x54, 0x0E, 0xDB, 0x79, 0x18, 0xBD, 0xC5, 0x04, 
+0xCC, 0x8B, 0x35, 0x9B, 0x0B, 0xAD, 0xF9, 0x54, 0xD4, 0x12, 0x5C, 0x6A, 0x40, 0x11, 0xB8, 0x09, 
+0x23, 0xA6, 0x8A, 0x34, 0x97, 0xE9, 0x27, 0xFB, 0x79, 0xA5, 0xA7, 0x71, 0x3B, 0x1A, 0xDD, 0x42, 
+0x73, 0xD0, 0xB5, 0xA4, 0x9B, 0x9C, 0x15, 0xFD, 0x44, 0x56, 0xF4, 0x97, 0x72, 0x3F, 0x3D, 0xCE, 
+0x94, 0x89, 0xF1, 0x72, 0x1A, 0x4C, 0x65, 0xD4, 0x74, 0x9A, 0x8B, 0xB8, 0x45, 0xFD, 0x2D, 0x10, 
+0xF0, 0x12, 0x1B, 0x87, 0x24, 0x18, 0x39, 0x17, 0x3B, 0x04, 0x60, 0x37, 0xF2, 0xBF, 0x85, 0xDF, 
+0x43, 0xEC, 0xB9, 0x4A, 0x3F, 0xED, 0x60, 0xC7, 0x6E, 0x64, 0x7F, 0x0D, 0xBF, 0x7F, 0xB8, 0x5E, 
+0x3D, 0x53, 0xAB, 0x97, 0xE4, 0x5C, 0x60, 0x14, 0xF7, 0x22, 0xD7, 0xC4, 0x4A, 0xAD, 0x6F, 0x62, 
+0xBE, 0x2D, 0xF8, 0x02, 0x7E, 0x8D, 0x26, 0x13, 0xFB, 0x8F, 0x3F, 0x35, 0x6F, 0x06, 0x51, 0x65, 
+0x84, 0xB5, 0x18, 0xB6, 0x0E, 0xAD, 0x99, 0x52, 0x67, 0xB4, 0x5B, 0x0E, 0x8D, 0xA1, 0x98, 0x1B, 
+0x6C, 0x34, 0xA5, 0x0C, 0xBA, 0x10, 0x7D, 0x41, 0x1C, 0xA2, 0x2C, 0xCC, 0xAE, 0xD1, 0xA8, 0xFA, 
+0xB4, 0x69, 0x0B, 0x3A, 0x88, 0xB4, 0xEA, 0xC6, 0xEC, 0x51, 0x75, 0x5A, 0x29, 0x5E, 0x0C, 0xED, 
+0x09, 0xF2, 0x04, 0xD9, 0x0B, 0xA8, 0xC6, 0xA3, 0x2B, 0x95, 0x2D, 0xA1, 0x0A, 0xE7, 0xDE, 0x82, 
+0xB5, 0xA0, 0x39, 0x8D, 0xD4, 0xB2, 0x36, 0x4D, 0x32, 0x93, 0x99, 0xF0, 0x4B, 0xB9, 0x56, 0x05, 
+0x19, 0xE4, 0x3C, 0x57, 0xBA, 0xB6, 0x07, 0x32, 0xE2, 0xF8, 0x68, 0x4B, 0x01, 0xED, 0x0D, 0x4F, 
+0x3A, 0x84, 0x6E, 0x08, 0xD6, 0x07, 0xBD, 0xB9, 0xD4, 0xE6, 0xFF, 0xA2, 0x80, 0xF5, 0x61, 0x34, 
+0x7A, 0x51, 0x0A, 0xB6, 0x56, 0x4B, 0xA6, 0x97, 0xD0, 0x30, 0x8A, 0xD9, 0xFE, 0xC1, 0xB8, 0x1C, 
+0xE1, 0xDF, 0x7D, 0xD1, 0xB0, 0x73, 0x66, 0x5E, 0xA4, 0x22, 0xAF, 0xA6, 0x3E, 0xCC, 0xF4, 0x5A, 
+0x4D, 0x6D, 0xE0, 0xC2, 0xEF, 0x37, 0xB2, 0x9C, 0x97, 0x5C, 0xCF, 0x88, 0xC9, 0xB6, 0xBE, 0x61, 
+0x91, 0x36, 0xF8, 0xB6, 0xD6, 0x68, 0xC3, 0xED, 0x4F, 0x2C, 0xF1, 0x66, 0x77, 0xA0, 0xFE, 0x4F, 
+0x76, 0x09, 0xB5, 0x85, 0x4E, 0xCA, 0xB6, 0x90, 0x7F, 0x09, 0x9F, 0x3E, 0x18, 0xE8, 0xB4, 0x94, 
+0x0B, 0x13, 0x62, 0xC2, 0x8F, 0xFC, 0x9E, 0xDB, 0x5E, 0x4A, 0x9F, 0xDD, 0x2E, 0x55, 0x41, 0xCD, 
+0x3E, 0x09, 0xA0, 0x1B, 0xAF, 0x99, 0x99, 0x09, 0x86, 0x1B, 0x43, 0x94, 0x1D, 0x6A, 0x63, 0xEE, 
+0xD5, 0x06, 0x54, 0x02, 0x1A, 0x0E, 0xEB, 0xCD, 0x4A, 0xB5, 0x58, 0x88, 0x0C, 0x58, 0x01, 0xBF, 
+0xC2, 0xC0, 0xD5, 0x8B, 0x7F, 0xFD, 0xE7, 0xF5, 0xAB, 0xEB, 0x8B, 0x5B, 0x36, 0x64, 0x8F, 0x7A, 
+0xF0, 0xA7, 0x5F, 0x0D, 0xDD, 0xBC, 0x79, 0x07, 0x9D, 0xA7, 0x4F, 0xEB, 0x1E, 0xBB, 0x2B, 0xA0, 
+0xF3, 0x7D, 0x74, 0x71, 0x75, 0x71, 0xF3, 0x73, 0xD4, 0x89, 0x5E, 0xBC, 0xBE, 0xB8, 0x79, 0x0B, 
+0xBF, 0xE7, 0x37, 0xAF, 0xF0, 0xE7, 0xE2, 0xE6, 0x06, 0xFE, 0x7D, 0xF7, 0xE2, 0xE6, 0xFA, 0xD5, 
+0x35, 0x0E, 0x5F, 0xBF, 0x79, 0xFB, 0xEA, 0xFC, 0x02, 0x1A, 0xAF, 0xAE, 0x2F, 0xDF, 0xC0, 0xCF, 
+0xCB, 0x8B, 0x9F, 0xFE, 0xF9, 0x73, 0x74, 0xD7, 0xC7, 0x3D, 0x78, 0x0F, 0x60, 0x72, 0x85, 0xD2, 
+0x8A, 0x65, 0x9E, 0xF7, 0x5D, 0x07, 0x4C, 0x54, 0x40, 0x8D, 0x12, 0x19, 0xF4, 0x4F, 0x78, 0xAE, 
+0x85, 0x1F, 0xD0, 0x86, 0x1B, 0x01, 0x9D, 0x00, 0x63, 0x31, 0x2F, 0x9F, 0xD9, 0x51, 0x58, 0x24, 
+0x64, 0xD9, 0x33, 0x66, 0xCA, 0x25, 0xB4, 0x31, 0x75, 0xBA, 0x01, 0xF6, 0x95, 0xE6, 0x00, 0xFB, 
+0x94, 0x00, 0x2A, 0x98, 0x9A, 0x58, 0x3B, 0x01, 0x25, 0x58, 0x11, 0xAA, 0x50, 0x66, 0x17, 0x63, 
+0x0B, 0x5A, 0x87, 0x4D, 0x64, 0x09, 0xEB, 0x93, 0x3A, 0xB0, 0x99, 0x9B, 0xD7, 0x9A, 0x17, 0x94, 
+0x04, 0x28, 0xF7, 0xA2, 0x04, 0xAC, 0x19, 0x57, 0x26, 0x6B, 0x7B, 0xDD, 0x2C, 0xF7, 0x90, 0xF5, 
+0x3A, 0xA0, 0xFF, 0xB2, 0xA0, 0xA6, 0x1F, 0x03, 0xF9, 0xE6, 0x56, 0xFC, 0x4A, 0x5D, 0x21, 0x58, 
+0x43, 0xCF, 0xC1, 0x10, 0xC0, 0xC1, 0x14, 0xE0, 0x2E, 0xFE, 0x08, 0x00, 0x85, 0x19, 0xA8, 0xA2, 
+0x4A, 0xF6, 0x5C, 0x4B, 0x88, 0x92, 0x21, 0xB8, 0x8D, 0xC6, 0xC9, 0x24, 0x80, 0xA0, 0x9C, 0xC8, 
+0x05, 0x2F, 0xF1, 0x70, 0xE1, 0x2D, 0xB7, 0x25, 0x12, 0x55, 0xEE, 0xB0, 0x42, 0x41, 0xE0, 0x88, 
+0x12, 0xE0, 0x39, 0x47, 0x73, 0xAE, 0x85, 0x5F, 0xD1, 0x02, 0x0A, 0x29, 0xDA, 0x04, 0xDC, 0x78, 
+0xD7, 0x6F, 0x6A, 0x34, 0x29, 0xE1, 0x90, 0xA3, 0x2B, 0x65, 0x18, 0xA9, 0x41, 0x36, 0x21, 0xC1, 
+0xBC, 0x90, 0x73, 0x8E, 0x8A, 0x58, 0x42, 0xEF, 0x99, 0x74, 0x26, 0x30, 0x35, 0xEE, 0x74, 0x99, 
+0x26, 0x97, 0x59, 0xB9, 0x67, 0x68, 0x20, 0xE7, 0x06, 0x68, 0x95, 0xA0, 0x87, 0x28, 0xC3, 0xF6, 
+0x15, 0x7E, 0xA0, 0xE7, 0x18, 0x80, 0xCA, 0x22, 0x53, 0xAB, 0xC4, 0x86, 0xF2, 0xAD, 0x13, 0x44, 
+0x02, 0xC9, 0xAF, 0x36, 0x1E, 0x09, 0x5F, 0x0F, 0x19, 0x1C, 0xEE, 0x96, 0x73, 0x38, 0x8A, 0x25, 
+0x53, 0x61, 0x2E, 0x72, 0x81, 0xCD, 0x9F, 0xD6, 0xAF, 0xB2, 0xB8, 0x85, 0xE3, 0xAD, 0x76, 0x1D, 
+0xBF, 0x84, 0x24, 0x0F, 0xD0, 0xE3, 0x78, 0x48, 0xEF, 0x90, 0xF0, 0x01, 0x0E, 0x4B, 0x81, 0x3C, 
+0xC0, 0x34, 0x59, 0x16, 0xE4, 0x26, 0x06, 0x54, 0x58, 0xFC, 0xE3, 0x36, 0xFB, 0x42, 0xF9, 0xC4, 
+0x4A, 0xFB, 0x4D, 0x94, 0xEA, 0x1F, 0x1C, 0xAD, 0x14, 0x17, 0xCB, 0x79, 0x9B, 0x0D, 0x47, 0xEC, 
+0xD6, 0x60, 0x74, 0xD2, 0x67, 0x02, 0xF8, 0x17, 0xD6, 0x59, 0x9A, 0xF8, 0x51, 0x87, 0xB5, 0x7A, 
+0x56, 0x0D, 0x6B, 0x47, 0xA3, 0x32, 0xBE, 0x76, 0x21, 0xF8, 0x12, 0x9C, 0x19, 0xBB, 0xB1, 0x52, 
+0x98, 0x65, 0x59, 0x78, 0xB9, 0x31, 0x91, 0xA1, 0x86, 0xBF, 0x28, 0x38, 0x0C, 0xC5, 0xED, 0xF6, 
+0x71, 0xEB, 0xAC, 0x75, 0xBC, 0x35, 0x7A, 0x25, 0x0B, 0x80, 0xE0, 0xFB, 0xC7, 0x6F, 0x31, 0xE0, 
+0x32, 0x3B, 0x0E, 0xA7, 0x8F, 0x16, 0xCE, 0xF5, 0xB5, 0xB1, 0xBC, 0xC5, 0x52, 0xCF, 0x5E, 0x83, 
+0x1B, 0x63, 0xDC, 0x4B, 0x7E, 0x8D, 0x10, 0x3D, 0xD1, 0xA0, 0x38, 0xD3, 0xE2, 0xD7, 0x51, 0x04, 
+0x67, 0x44, 0x70, 0x39, 0x1C, 0x30, 0x70, 0xDF, 0x71, 0x72, 0x39, 0xEE, 0x2D, 0x09, 0x4E, 0x5C, 
+0x94, 0x52, 0x95, 0xD2, 0xAC, 0x69, 0x0B, 0xBA, 0xD8, 0x87, 0xE5, 0x8F, 0x31, 0x5F, 0xE1, 0xA9, 
+0x0A, 0x52, 0x58, 0x75, 0x3C, 0xBE, 0xBD, 0xAA, 0x4C, 0x90, 0x52, 0xDA, 0x89, 0xF2, 0xCF, 0x51, 
+0x60, 0x16, 0x8E, 0x31, 0xDC, 0xFD, 0xF7, 0x20, 0xFE, 0x90, 0xB5, 0xE3, 0xE7, 0x67, 0x67, 0xF0, 
+0x7B, 0xDC, 0x6E, 0x3F, 0x1F, 0x75, 0x13, 0xF1, 0x59, 0xA4, 0x56, 0x3B, 0x4B, 0x2E, 0x27, 0x2C, 
+0x06, 0x72, 0xAF, 0x2B, 0xAB, 0xE4, 0x45, 0xEC, 0x18, 0xE5, 0xBC, 0x3F, 0xBD, 0xF3, 0x07, 0x2A, 
+0x47, 0xFA, 0xFE, 0xD1, 0x5D, 0x4D, 0xED, 0xC2, 0x99, 0x76, 0xF1, 0x35, 0x29, 0xEB, 0x49, 0xEA, 
+0x63, 0x18, 0xF2, 0x21, 0xC5, 0x60, 0xE8, 0xB7, 0x7C, 0xDB, 0x39, 0xA8, 0x5F, 0xEF, 0x2F, 0x9E, 
+0x97, 0x80, 0xAC, 0xD7, 0x6C, 0x0A, 0x7B, 0x73, 0x25, 0xCD, 0x8C, 0xB6, 0xD6, 0x0C, 0x8A, 0xBA, 
+0x2A, 0xD7, 0x95, 0xA4, 0x3A, 0x63, 0x80, 0x3C, 0x3F, 0x81, 0x47, 0xF2, 0x94, 0xBE, 0x86, 0xF4, 
+0x93, 0xE8, 0xE5, 0x58, 0xDB, 0x00, 0x42, 0x6D, 0x7A, 0x77, 0x49, 0x2E, 0x8A, 0xA9, 0x99, 0x39, 
+0xA5, 0x2C, 0x07, 0x6D, 0xB7, 0xF7, 0xB1, 0xCD, 0x50, 0xC7, 0x36, 0x3D, 0xB5, 0xD9, 0x5F, 0xEB, 
+0xBC, 0x7F, 0x87, 0x79, 0x00, 0xC5, 0x75, 0xD0, 0x28, 0x77, 0xB5, 0xBD, 0x6C, 0x26, 0x1B, 0xD4, 
+0x94, 0x6D, 0xCB, 0x7D, 0x7C, 0x6C, 0x69, 0x04, 0x66, 0x59, 0x9F, 0xF9, 0xAA, 0x09, 0x4E, 0x1B, 
+0xC2, 0x2D, 0x25, 0x6D, 0xDB, 0x84, 0x34, 0xB1, 0xCC, 0xCD, 0x70, 0xE2, 0x0B, 0xCC, 0x48, 0x71, 
+0xC6, 0x0D, 0xF7, 0x26, 0x77, 0x29, 0x2A, 0xC1, 0x48, 0xB3, 0x03, 0xA1, 0x24, 0x9B, 0x4D, 0xBC, 
+0x1E, 0xA8, 0xEB, 0xC3, 0x2A, 0x07, 0xD5, 0x4E, 0x0B, 0xD3, 0x12, 0x96, 0x07, 0x6F, 0xC9, 0x52, 
+0xFC, 0xBA, 0x84, 0xF4, 0xFE, 0xC2, 0xE7, 0xB2, 0x4B, 0x94, 0x16, 0x4F, 0x72, 0x98, 0x2A, 0xB0, 
+0xDC, 0x57, 0x57, 0x3D, 0x78, 0x9E, 0xFB, 0xAC, 0x88, 0xB1, 0x5C, 0x6C, 0xE6, 0x40, 0x2A, 0xAA, 
+0x1A, 0x80, 0x99, 0xC1, 0xA0, 0xB7, 0xC5, 0xC2, 0x86, 0x36, 0x26, 0x34, 0x98, 0x9C, 0x63, 0xF1, 
+0x4D, 0x45, 0xB8, 0x60, 0x9A, 0xAB, 0x4A, 0x0E, 0x3B, 0xD3, 0xA7, 0x8B, 0x70, 0xEB, 0xEC, 0xD8, 
+0x27, 0xFC, 0xDF, 0x7F, 0x67, 0x51, 0xD4, 0x06, 0x2B, 0x7B, 0xFB, 0x7C, 0x54, 0xB2, 0x88, 0xA1, 
+0xAB, 0x1F, 0x5A, 0xCD, 0x26, 0xF6, 0x4A, 0x08, 0x32, 0xEB, 0x2A, 0x64, 0x50, 0xD3, 0x38, 0xFA, 
+0x50, 0x54, 0x3C, 0x55, 0x2D, 0x21, 0xBA, 0x64, 0xA1, 0x16, 0x71, 0xB0, 0x69, 0xAA, 0xE1, 0xE1, 
+0x90, 0xA6, 0xDE, 0x28, 0x3D, 0x95, 0x08, 0x70, 0x8A, 0x2A, 0x2F, 0x78, 0x3A, 0x8B, 0x7D, 0x72, 
+0xA8, 0x72, 0x14, 0xDA, 0x01, 0x1C, 0x84, 0xE5, 0x3B, 0xC1, 0x02, 0xDD, 0xDE, 0x8E, 0x00, 0xA3, 
+0x0C, 0xCF, 0xD1, 0x20, 0x3E, 0xA5, 0xD9, 0xD8, 0x3B, 0xAE, 0xE7, 0x7F, 0xCE, 0x4E, 0x19, 0xD4, 
+0x86, 0x76, 0x7F, 0x83, 0x13, 0x0D, 0x1E, 0x4B, 0x6F, 0x4A, 0xD4, 0x58, 0x42, 0xC8, 0xBA, 0x28, 
+0x77, 0xC2, 0x36, 0xB6, 0x80, 0x6C, 0x86, 0x7F, 0x23, 0x95, 0xBE, 0x77, 0xF3, 0x75, 0x28, 0xD5, 
+0xDC, 0xF5, 0x83, 0x40, 0x50, 0x45, 0xEE, 0xD1, 0x95, 0x96, 0x63, 0x38, 0x22, 0x50, 0x31, 0x41, 
+0xEF, 0x83, 0xDF, 0xB1, 0xFF, 0xE5, 0x9B, 0xAB, 0x50, 0x33, 0xB7, 0xF0, 0x89, 0xCA, 0x73, 0xB5, 
+0xF2, 0x0A, 0xBA, 0xAA, 0x58, 0xA2, 0x57, 0x17, 0xA2, 0x04, 0x9B, 0xCD, 0x11, 0x0E, 0x26, 0x85, 
+0x5A, 0xC5, 0x41, 0xC2, 0x2F, 0xD0, 0x5D, 0xD6, 0x26, 0x2E, 0xEE, 0xA9, 0xCC, 0x24, 0x74, 0x42, 
+0x4F, 0xEC, 0x8D, 0x07, 0x95, 0x11, 0xF6, 0x37, 0x44, 0x69, 0x18, 0x11, 0xD1, 0xC2, 0xA7, 0x46, 
+0x34, 0x82, 0x9F, 0x15, 0x0B, 0x60, 0x02, 0x70, 0x11, 0x3E, 0xDF, 0xAA, 0x05, 0x7A, 0xCD, 0x72, 
+0xF4, 0x1F, 0x54, 0x73, 0x41, 0x9E, 0x9E, 0xC3, 0xC0, 0x15, 0x37, 0xB3, 0x64, 0xCE, 0x3F, 0xC7, 
+0x50, 0x8C, 0xA9, 0x3D, 0xC9, 0x95, 0x2A, 0xE3, 0x0D, 0x01, 0x5D, 0x3B, 0xDD, 0x09, 0x7B, 0xD2, 
+0x28, 0x4F, 0x15, 0x3F, 0x44, 0x63, 0xD1, 0xB1, 0x22, 0x8F, 0x6D, 0x17, 0x00, 0x89, 0xDC, 0x4A, 
+0x01, 0x4C, 0x0C, 0x65, 0xF3, 0x17, 0xAB, 0x7C, 0xD7, 0xEB, 0x7D, 0xDA, 0xF3, 0x81, 0x02, 0xE6, 
+0x74, 0x0B, 0x34, 0xA4, 0x6A, 0x4C, 0x62, 0x36, 0x16, 0x58, 0x4D, 0x8A, 0x08, 0x39, 0x08, 0x74, 
+0x04, 0x4D, 0x31, 0xF6, 0x4B, 0xDC, 0x45, 0xC0, 0xD8, 0x67, 0x18, 0x08, 0x78, 0xA7, 0x26, 0x8F, 
+0x8F, 0xEB, 0xA4, 0x40, 0x88, 0x0C, 0x48, 0x5C, 0xDC, 0xF4, 0x83, 0x6E, 0x3C, 0x67, 0x05, 0x95, 
+0x3E, 0x85, 0x4C, 0x6D, 0x84, 0x2B, 0xF6, 0x70, 0xC8, 0x95, 0xF7, 0xAD, 0x8A, 0x1C, 0x3E, 0x12, 
+0x02, 0x8E, 0xD7, 0x98, 0x01, 0x40, 0x5A, 0x50, 0x3F, 0x70, 0x0C, 0xB7, 0xDA, 0xB9, 0xBD, 0x1E, 
+0xA6, 0xD1, 0x5E, 0x35, 0x8A, 0x6A, 0xBB, 0xAC, 0x26, 0xEF, 0x1B, 0x89, 0x9A, 0xD6, 0x5F, 0x0A, 
+0xBA, 0x31, 0x39, 0x9F, 0xC9, 0x3C, 0x83, 0x00, 0x8A, 0x93, 0x24, 0x41, 0x8E, 0x46, 0xF6, 0x73, 
+0xB0, 0xC9, 0xA7, 0xBF, 0xB0, 0xF3, 0x4A, 0xB3, 0xE3, 0x1D, 0x81, 0x05, 0xFE, 0xA2, 0xA0, 0xAB, 
+0xC2, 0x99, 0xFC, 0xC1, 0xB3, 0xEC, 0xE2, 0x1E, 0x34, 0x7C, 0x0D, 0xE5, 0x47, 0x14, 0x10, 0xAA, 
+0x2D, 0xEB, 0xE7, 0x56, 0x87, 0xC5, 0x04, 0x4E, 0x7C, 0x04, 0x63, 0x4E, 0x6A, 0xB7, 0x03, 0x50, 
+0xB6, 0xCD, 0x09, 0x27, 0x2B, 0xF9, 0x9B, 0xD8, 0xCB, 0x19, 0xEE, 0x0B, 0xD0, 0x8B, 0x4F, 0x05, 
+0xD6, 0x78, 0xC8, 0x05, 0xC2, 0xC4, 0x01, 0x7E, 0xE0, 0x13, 0xC0, 0xAB, 0x80, 0x17, 0x42, 0xC8, 
+0x5B, 0xEF, 0x3B, 0x0B, 0x16, 0x34, 0xE1, 0xDA, 0x0A, 0xA0, 0x02, 0xAA, 0xB5, 0x19, 0x18, 0x4D, 
+0x8D, 0xD7, 0x78, 0x24, 0x6B, 0xE5, 0x01, 0x7B, 0x3D, 0x4D, 0xB4, 0xD2, 0x67, 0xDD, 0x2E, 0x96, 
+0xFB, 0xCA, 0xC3, 0x90, 0x8C, 0x28, 0x91, 0x27, 0x33, 0x45, 0x89, 0x21, 0xEA, 0xAE, 0xC4, 0x58, 
+0x13, 0xF2, 0x58, 0x69, 0x87, 0xC0, 0x91, 0xC1, 0x97, 0x73, 0x17, 0x7D, 0xE0, 0x26, 0x55, 0x28, 
+0xC8, 0xB5, 0x18, 0x69, 0x6E, 0x55, 0x71, 0x1D, 0x61, 0xAE, 0x9A, 0xD5, 0x10, 0x10, 0x04, 0xBF, 
+0xBB, 0xBA, 0xFD, 0x19, 0x9C, 0x70, 0x5E, 0x9D, 0x6D, 0xC0, 0xAF, 0x75, 0x0A, 0x66, 0x8D, 0x43, 
+0x4F, 0x5D, 0xAA, 0xBE, 0x86, 0x13, 0xA6, 0x78, 0x90, 0x0F, 0x67, 0x14, 0xE8, 0x81, 0x6F, 0x9A, 
+0xF6, 0xA5, 0xD4, 0xE9, 0xBE, 0x99, 0x1B, 0xE7, 0xAF, 0x4D, 0x55, 0x82, 0x6A, 0xC4, 0x10, 0x9C, 
+0xA1, 0x64, 0xB5, 0x34, 0xF1, 0x86, 0x0B, 0x3B, 0xEC, 0x49, 0xCF, 0xEF, 0xE2, 0x86, 0xCE, 0xEE, 
+0x9E, 0xEF, 0x80, 0xD6, 0x98, 0xAB, 0xA8, 0x2B, 0xC1, 0x22, 0xCF, 0xB0, 0xC8, 0x1C, 0xE1, 0x2C, 
+0x6F, 0xAE, 0xA1, 0xD6, 0x40, 0x39, 0x80, 0x49, 0x11, 0xFB, 0xFB, 0x4B, 0xB5, 0x0E, 0x59, 0x07, 
+0x8A, 0x40, 0x85, 0xAC, 0xBE, 0x1E, 0x10, 0x44, 0xF7, 0x77, 0x24, 0x29, 0x14, 0x64, 0xAF, 0xF7, 
+0x2A, 0x49, 0x87, 0x05, 0x25, 0xB4, 0x6F, 0xF4, 0x3B, 0x80, 0x6A, 0x71, 0x74, 0x64, 0xEF, 0x86, 
+0x34, 0x8B, 0xDA, 0x24, 0x72, 0xA6, 0x56, 0xAE, 0xA7, 0xC1, 0x51, 0x81, 0xB2, 0x1F, 0xDB, 0x7F, 
+0x52, 0x3E, 0x82, 0x3E, 0x2B, 0xDB, 0x6D, 0x08, 0x1F, 0xF2, 0x36, 0x9D, 0xDB, 0xBC, 0x0A, 0x5B, 
+0xA1, 0x84, 0xD3, 0x1D, 0xEE, 0x92, 0xB1, 0x52, 0xE8, 0x28, 0xFB, 0xF2, 0x64, 0xB7, 0x38, 0x54, 
+0xA4, 0x29, 0xB7, 0xE8, 0x7B, 0xCE, 0x7A, 0x4D, 0x70, 0x5A, 0x43, 0x24, 0x07, 0x40, 0xFA, 0x3B, 
+0x20, 0xA7, 0x83, 0xB7, 0x3B, 0x17, 0xF4, 0xA4, 0x1D, 0xB0, 0xB8, 0x85, 0x6D, 0xC0, 0xD3, 0x5D, 
+0x7E, 0xA0, 0xD3, 0x1B, 0xFA, 0x13, 0x16, 0x86, 0x39, 0x1E, 0xE3, 0xD4, 0xF5, 0x1E, 0x31, 0xDC, 
+0x60, 0x7F, 0xBF, 0x7D, 0x73, 0x9D, 0xD8, 0x39, 0xE4, 0x64, 0x1D, 0x53, 0x46, 0xDB, 0x65, 0x3B, 
+0x17, 0xE3, 0xB5, 0xFC, 0x3A, 0xE8, 0x7C, 0xE4, 0x81, 0x9F, 0x5F, 0xE1, 0xFB, 0xCF, 0x3D, 0xD4, 
+0x4E, 0x97, 0x8C, 0x6A, 0x68, 0x10, 0x43, 0xB4, 0x3F, 0xB4, 0xE1, 0xDE, 0x66, 0xDF, 0x7D, 0xC7, 
+0x62, 0xCA, 0xB8, 0x80, 0xC7, 0x6F, 0xED, 0xDD, 0xC2, 0x10, 0xD0, 0x6B, 0xBB, 0x52, 0xB1, 0xD5, 
+0x6A, 0xF7, 0x9D, 0x1F, 0x66, 0x02, 0x4B, 0xF6, 0x18, 0x0A, 0x02, 0x4E, 0x44, 0xF1, 0xDE, 0xDB, 
+0x48, 0x6B, 0x55, 0x80, 0xE1, 0x33, 0x61, 0x07, 0x0A, 0x4A, 0x0E, 0xE1, 0xE5, 0x11, 0x1E, 0x0E, 
+0xBC, 0xC7, 0x01, 0x04, 0xDB, 0x34, 0x64, 0x15, 0xDF, 0x77, 0xAC, 0x44, 0xD2, 0x76, 0xA3, 0xC2, 
+0x10, 0x13, 0xA0, 0xA0, 0x48, 0x15, 0x11, 0x00, 0xA1, 0x28, 0xDA, 0x05, 0xA2, 0xE8, 0xFE, 0x98, 
+0x78, 0xFD, 0xC4, 0x4D, 0xA5, 0x1E, 0x06, 0x8A, 0x04, 0x18, 0xAF, 0xA0, 0x29, 0x86, 0xCC, 0xDF, 
+0x7C, 0x63, 0x32, 0xCD, 0xCE, 0xE7, 0x59, 0x6C, 0x31, 0x1B, 0xF5, 0xE2, 0xD4, 0x7E, 0x3F, 0xE1, 
+0xFC, 0xB6, 0x7D, 0x79, 0x19, 0xED, 0x92, 0x63, 0x2F, 0xC0, 0xD9, 0x86, 0x1C, 0xEC, 0x45, 0x31, 
+0x6E, 0x7F, 0xA3, 0x14, 0x6A, 0xEE, 0x11, 0x62, 0xAF, 0xC1, 0xBF, 0x11, 0x40, 0x56, 0xCF, 0x04, 
+0x81, 0xB7, 0xAB, 0x4C, 0x56, 0xBB, 0x74, 0xEF, 0x31, 0x7E, 0xAE, 0x61, 0xDD, 0x89, 0x75, 0x5A, 
+0x08, 0xFA, 0xB0, 0xEE, 0xB8, 0xED, 0xC5, 0x0B, 0xBD, 0x82, 0xB2, 0x5B, 0x1F, 0xDB, 0x34, 0xC7, 
+0x02, 0xE4, 0xB7, 0x28, 0x3E, 0x72, 0x20, 0xF6, 0xC6, 0xF3, 0x02, 0x8E, 0xAE, 0xB0, 0xB7, 0x01, 
+0xFA, 0xE5, 0x37, 0xA9, 0xD8, 0x3A, 0xC2, 0x77, 0x0B, 0xD6, 0x0A, 0x0B, 0xD5, 0x01, 0x6D, 0x81, 
+0xAC, 0x75, 0xD4, 0xAA, 0x75, 0xFE, 0x03, 0x9E, 0xED, 0xCA, 0xFD, 0x49, 0xAC, 0x97, 0x0B, 0x48, 
+0x87, 0xBB, 0x33, 0x74, 0xBD, 0x9D, 0x81, 0xCE, 0x1E, 0x02, 0x2E, 0x70, 0x7B, 0x45, 0xED, 0xDA, 
+0xE4, 0x34, 0xF7, 0xE6, 0x6E, 0x08, 0x72, 0x23, 0xDE, 0x59, 0x87, 0xF8, 0xD7, 0x21, 0xB7, 0xC8, 
+0xC1, 0x55, 0x1C, 0xF6, 0xC7, 0x92, 0x4E, 0xD4, 0xAE, 0xCE, 0x11, 0x80, 0xE4, 0x8D, 0x98, 0x07, 
+0x3B, 0xD8, 0x72, 0x7F, 0x42, 0x90, 0x86, 0x23, 0x9E, 0x67, 0x58, 0x17, 0x33, 0x92, 0x0C, 0x00, 
+0xA8, 0x85, 0x77, 0xE6, 0x23, 0x34, 0xE1, 0xA7, 0x7B, 0xC0, 0x5E, 0x68, 0x23, 0x36, 0x70, 0x6F, 
+0x5F, 0x50, 0x49, 0x67, 0xBC, 0x98, 0x42, 0x65, 0xF7, 0x16, 0xFF, 0xD0, 0x3A, 0xA2, 0xF7, 0x12, 
+0xD6, 0x64, 0xF8, 0x80, 0x9F, 0x06, 0xCE, 0xE6, 0x95, 0xA1, 0x81, 0xF0, 0x03, 0xDE, 0xE0, 0xB6, 
+0xFC, 0x7C, 0xF6, 0x3A, 0x34, 0xD0, 0xD8, 0x6E, 0x33, 0xD9, 0x50, 0x3A, 0x54, 0x4B, 0x2D, 0xC8, 
+0x3A, 0x24, 0x70, 0x18, 0xE1, 0x04, 0x12, 0xE7, 0xA2, 0x16, 0x1C, 0x5C, 0xC0, 0xBC, 0x30, 0xFF, 
+0xE9, 0x1D, 0xEC, 0x92, 0x96, 0x7B, 0xAB, 0x13, 0x59, 0x0B, 0x36, 0x0A, 0xA4, 0x22, 0xA4, 0xA3, 
+0x25, 0xD1, 0x06, 0x81, 0x8F, 0x41, 0xD7, 0x4A, 0xAB, 0xD5, 0xF9, 0xBA, 0xC3, 0x10, 0x5D, 0x2B, 
+0xC6, 0x3D, 0x19, 0x38, 0x52, 0x4F, 0xB8, 0x3F, 0x58, 0xAC, 0xEB, 0x20, 0x60, 0x24, 0x04, 0x68, 
+0xF9, 0xCB, 0xDB, 0xAB, 0xD7, 0x60, 0x75, 0x94, 0xBA, 0x63, 0xEB, 0xD5, 0x2F, 0x38, 0xB2, 0x3A, 
+0x7D, 0xEF, 0x93, 0x0C, 0x14, 0x89, 0x8B, 0x0D, 0x7F, 0xB8, 0xF1, 0x5B, 0xCD, 0xDD, 0x82, 0xB8, 
+0x6D, 0x05, 0x67, 0x8A, 0x09, 0xA4, 0xBF, 0x99, 0xBF, 0xD2, 0xF6, 0x9B, 0xD0, 0x21, 0xC4, 0xB4, 
+0x94, 0x46, 0xA6, 0x70, 0x2E, 0x74, 0x10, 0x63, 0x53, 0xA1, 0xE0, 0x55, 0x2B, 0x88, 0xBC, 0x31, 
+0x27, 0x08, 0xB5, 0x0D, 0x00, 0x17, 0x70, 0x52, 0x41, 0xBB, 0x7A, 0xFC, 0x1D, 0x77, 0x3F, 0x74, 
+0xFF, 0xD2, 0xED, 0xA0, 0xDD, 0xDD, 0xF1, 0x42, 0x18, 0x70, 0x30, 0xF1, 0x83, 0xE9, 0xBB, 0xD5, 
+0x73, 0x0D, 0x58, 0x08, 0xB4, 0x2B, 0xE2, 0xB8, 0xB4, 0xB8, 0x37, 0xF9, 0xA8, 0x11, 0x0C, 0xFA, 
+0x5E, 0x1B, 0xFA, 0x1B, 0x11, 0xEC, 0xE2, 0x9F, 0xE2, 0xDE, 0x5E, 0xD8, 0xA0, 0xBF, 0xC9, 0xCD, 
+0xF4, 0x46, 0x50, 0x45, 0x17, 0x6D, 0x0C, 0x55, 0x9A, 0x38, 0xE6, 0x1D, 0x36, 0x26, 0x39, 0xE3, 
+0xA4, 0x00, 0x40, 0xC7, 0x93, 0xA2, 0xDE, 0x27, 0xB1, 0xDE, 0x1B, 0x6E, 0xF4, 0x4A, 0xC4, 0xD9, 
+0xAC, 0x14, 0x13, 0x1B, 0x6D, 0x5B, 0x0B, 0x78, 0x5E, 0x0C, 0xB1, 0x5F, 0x83, 0x58, 0x8C, 0xC3, 
+0x11, 0xF6, 0x07, 0x1D, 0x60, 0xA1, 0xE9, 0xA0, 0xCB, 0x47, 0xCC, 0xF6, 0x21, 0xC6, 0xA7, 0xBD, 
+0x31, 0x5E, 0x1B, 0xA1, 0x1B, 0x21, 0x15, 0x46, 0xDF, 0xFE, 0xCB, 0x52, 0xF7, 0x82, 0xB5, 0x27, 
+0xAE, 0xA8, 0x62, 0x05, 0xEF, 0x81, 0x81, 0x95, 0x7D, 0xDC, 0x26, 0xE0, 0x30, 0x5C, 0x33, 0x2D, 
+0xF9, 0x00, 0xE4, 0xBD, 0x56, 0xCC, 0x73, 0x33, 0xBD, 0x5C, 0xE0, 0xFF, 0xB0, 0x83, 0xA8, 0x77, 
+0x47, 0xE5, 0x08, 0x9E, 0x68, 0xE0, 0xEC, 0xCF, 0xE7, 0x3E, 0x5E, 0xDE, 0xFB, 0xE7, 0x54, 0x88, 
+0x82, 0x5A, 0x91, 0x0E, 0xF3, 0xAF, 0x9D, 0xD0, 0xB2, 0xEF, 0x95, 0x77, 0x61, 0xC6, 0xCA, 0x48, 
+0xB1, 0x43, 0xD1, 0x4F, 0x38, 0x1E, 0x74, 0x6D, 0xDE, 0xB1, 0xF0, 0x39, 0x41, 0x25, 0x7C, 0xFE, 
+0x8A, 0x6A, 0x74, 0xEC, 0x2F, 0xD7, 0x1A, 0x6F, 0x0A, 0xCD, 0x4B, 0x9B, 0x10, 0xBA, 0xBB, 0x4A, 
+0x69, 0x81, 0x6D, 0x70, 0xB2, 0xF4, 0x65, 0xD8, 0xAE, 0x6F, 0x77, 0xF1, 0xAC, 0xC7, 0x83, 0xCC, 
+0xFF, 0x30, 0xA8, 0x4F, 0x21, 0xDC, 0x6B, 0x2A, 0x6D, 0x9F, 0xDF, 0x08, 0xDF, 0x05, 0x55, 0xEC, 
+0x3C, 0x17, 0xBC, 0xA0, 0xA1, 0xA3, 0xD6, 0xCE, 0xB5, 0xD6, 0xE8, 0x3C, 0x64, 0x73, 0xBD, 0x07, 
+0x79, 0x10, 0x30, 0x6C, 0xF3, 0x5C, 0x5E, 0xEE, 0x61, 0xAA, 0xCF, 0x13, 0x21, 0x93, 0xED, 0x3D, 
+0xC4, 0x62, 0xA7, 0xD9, 0x64, 0xD9, 0x3B, 0x0D, 0xBD, 0x05, 0x06, 0xCE, 0xAB, 0xF9, 0x68, 0xE4, 
+0xA8, 0xBE, 0x3D, 0xD8, 0x3E, 0x8B, 0xD8, 0x83, 0xF2, 0xF6, 0xB8, 0x3B, 0xF4, 0x84, 0xC3, 0xD5, 
+0xDD, 0xE4, 0x21, 0x29, 0x7B, 0x8E, 0x4D, 0x8D, 0x11, 0xC2, 0x57, 0x21, 0xD3, 0xD6, 0xC1, 0xBC, 
+0xFF, 0x00, 0xCA, 0x07, 0x3D, 0x35, 0x8E, 0x1E, 0xFC, 0x17, 0x33, 0xEF, 0x58, 0x82, 0x42, 0x27, 
+0x00, 0x00
 };
 
 
 /**
  * 
 <!doctype html>
-<!-- Material design icons - https://zavoloklom.github.io/material-design-iconic-font/icons.html -->
 <html>
   <head>
-    <link rel="stylesheet" type="text/css" href="https://cdn.rawgit.com/OnsenUI/OnsenUI-dist/2.0.0-beta.5/css/onsenui.css">
-    <link rel="stylesheet" type="text/css" href="https://cdn.rawgit.com/OnsenUI/OnsenUI-dist/2.0.0-beta.5/css/onsen-css-components.css"> 
-    <script src="https://cdn.rawgit.com/OnsenUI/OnsenUI-dist/2.0.0-beta.5/js/onsenui.js"></script>
-
+    <meta charset="utf-8">
+    <meta name="viewport" content="width=device-width, initial-scale=1">
+    <title>WebSerial</title>
     <style type="text/css">
-        .content {
-          display: flex;
-          width: 100%; 
-        }
-
-        .box {
-            width: 50px;
-          }
-
-        .row {
-          flex-direction: row;
-          flex : 1;
-          display: flex;
-          align-items: center;
-        }
-
-        .input {
-          flex-grow: 1;
-          margin-bottom: 10px;
-          margin-right: 10px
-        }
-
-        .button1 {          
-          width: 100px;
-          margin-bottom: 10px;          
-        }
-
-        .text {
-          overflow:scroll;
-          font-family: monospace;
-          background-color: #E8E8E8;
-          width: 100%;   
-          height: 400px;       
-        }      
+      body      { margin: 0; font-family: sans-serif; }
+      .bar      { display: flex; gap: 6px; padding: 10px; flex-wrap: wrap; }
+      .bar input{ flex: 1; min-width: 150px; padding: 6px; }
+      button    { padding: 6px 10px; border: 0; border-radius: 3px; color: white; background: gray; cursor: pointer; }
+      button.on { background: #3399ff; }
+      #send     { background: #3399ff; }
+      #reset    { background: #B370FF; }
+      #view     { position: relative; overflow-y: auto; height: calc(100vh - 60px); margin: 0 10px;
+                  background: #E8E8E8; font-family: monospace; font-size: 13px; }
+      #spacer   { position: absolute; top: 0; left: 0; width: 1px; }
+      #rows     { position: absolute; left: 0; right: 0; padding: 0 4px; }
+      #rows div { height: 16px; line-height: 16px; white-space: pre; }
+      .l0,.l1,.l2 { color: white; background: #c00; }
+      .l3       { color: #c00; }
+      .l4       { color: #b60; }
+      .l5       { color: #060; }
+      .l6       { color: black; }
+      .l7       { color: #777; }
+      .lx       { color: #00a; }
+      dialog select { margin: 4px; }
     </style>
   </head>
-  
+
   <body>
-    <div style="padding: 20px; width: max-20px; height: 500px;  ">
-      <div class="content row" >
-          <input id='idMessage' type="text" class="text-input input" placeholder="text" value="" >
-          <button id="idSend" class="button button--material button1" onclick=myBtn()>Send</button>
-      </div>
-      <div class="content">
-        <textarea id='messages' rows="3" style="position: relative;" readonly='readonly' class="textarea text" placeholder="Textarea"></textarea>
-      
-        <ons-speed-dial id="IDdial" direction="left" style="position: absolute; top: 60px;right: 15px;opacity: 0.5; margin: 20px;z-index: 9;" onclick=myDial()>
-          <ons-icon id="IDmenu" icon="md-menu"></ons-icon>
-          <ons-speed-dial-item >
-            <ons-icon id="IDdebug" icon="md-bug" onclick=myDebug()></ons-icon>
-          </ons-speed-dial-item>
-          <ons-speed-dial-item >
-            <ons-icon id="IDlock" icon="md-lock-outline" onclick=myLock()></ons-icon>
-          </ons-speed-dial-item>
-          <ons-speed-dial-item >
-            <ons-icon id="IDtime" icon="md-time" onclick=myTime()></ons-icon>
-          </ons-speed-dial-item>
-          <ons-speed-dial-item >
-            <ons-icon id="IDdelete" icon="md-delete" onclick=myDelete()></ons-icon>
-          </ons-speed-dial-item>
-          <ons-speed-dial-item >
-            <ons-icon id="IDreset" icon="md-replay"  onclick=myReset()></ons-icon>
-          </ons-speed-dial-item>
-        </ons-speed-dial>    
-      </div> 
+    <div class="bar">
+      <input id="msg" type="text" placeholder="Type any message">
+      <button id="send" onclick="sendMsg()">Send</button>
+      <button onclick="findMsg()">Find</button>
+      <button id="debug" onclick="toggle('debug')">Debug</button>
+      <button id="time" onclick="toggle('time')">Time</button>
+      <button id="lock" onclick="toggle('lock')">Lock</button>
+      <button onclick="showDialog('levels')">Levels</button>
+      <button onclick="showSnapshots()">Snapshots</button>
+      <button onclick="showDialog('delete')">Delete</button>
+      <button id="reset" onclick="showDialog('reset')">Reset</button>
     </div>
-    
-    <ons-alert-dialog id="myDelete-dialog" modifier="material">
-      <div class="alert-dialog-title">Confirmation</div>
-      <div class="alert-dialog-content">
-        Are you sure to delete 
-      </div>
-      <div class="alert-dialog-footer">
-        <button class="alert-dialog-button" onclick="hideAlertDialog('None')">Cancel</button>  
-        <button class="alert-dialog-button" onclick="hideAlertDialog('Logs')">Logs</button>  
-        <button class="alert-dialog-button" onclick="hideAlertDialog('Crashs')">Crashs</button>  
-      </div>
-    </ons-alert-dialog>
-
-   <ons-alert-dialog id="myReset-dialog" modifier="material">
-      <div class="alert-dialog-title">Confirmation</div>
-      <div class="alert-dialog-content">
-        Are you sure to Reset 
-      </div>
-      <div class="alert-dialog-footer">
-        <button class="alert-dialog-button" onclick="hideAlertDialog('Reset')">Reset</button>  
-        <button class="alert-dialog-button" onclick="hideAlertDialog('Cancel')">Cancel</button>  
-      </div>
-    </ons-alert-dialog>
-
-  
+    <div id="view"><div id="spacer"></div><div id="rows"></div></div>
+
+    <dialog id="levels"><b>Module levels</b><div id="modules"></div><button onclick="hideDialog('None')">Close</button></dialog>
+    <dialog id="snapshots"><b>Snapshots</b><div id="snaplist"></div><button onclick="hideDialog('None')">Close</button></dialog>
+    <dialog id="delete">Are you sure to delete<br><br>
+      <button onclick="hideDialog('None')">Cancel</button> <button onclick="hideDialog('Logs')">Logs</button> <button onclick="hideDialog('Crashs')">Crashs</button></dialog>
+    <dialog id="reset">Are you sure to Reset<br><br>
+      <button onclick="hideDialog('Reset')">Reset</button> <button onclick="hideDialog('None')">Cancel</button></dialog>
   </body>
 </html>
 
 <script type="text/javascript">
-  console.log("open");
+  // lines kept by the viewer, the oldest ones are dropped
+  const MAX_LINES = 20000;
+  const ROW = 16;
+  const levels = ["EMERG","ALERT","CRIT","ERR","WARNING","NOTICE","INFO","DEBUG"];
 
   var ws = null;
-  var startTime = null;
   var connected = false;
+  var state = { debug: false, time: true, lock: false };
+
+  // ring of lines: text and level class, first is the oldest
+  var lines = new Array(MAX_LINES);
+  var first = 0, count = 0;
+  var lastSeq = 0;            // last record received, for ?since= on reconnection
+  var partial = null;         // last line, not terminated yet
+  var pending = [];           // frames received since the last animation frame
+  var scheduled = false;
+  var stats = { frames: 0, lines: 0, renders: 0, renderMs: 0 };
+  window.viewerStats = stats;
+
+  const view = document.getElementById('view');
+  const rows = document.getElementById('rows');
+  const spacer = document.getElementById('spacer');
+
+  function getTime() {
+    const zeroPad = (num) => String(num).padStart(2, '0');
+    var today = new Date();
+    return zeroPad(today.getHours())+':'+zeroPad(today.getMinutes())+':'+zeroPad(today.getSeconds())+' - ';
+  }
 
-  startTime = new Date();
+  function pushLine(text) {
+    // "<n:seq>" in front of a line is its priority and record number, set by WebSerialSM
+    var cls = "lx";
+    var tag = /^<(\d)(?::(\d+))?>/.exec(text);
+    if (tag) {
+      cls = "l" + tag[1];
+      if (tag[2]) {
+        var seq = Number(tag[2]);
+        if (seq <= lastSeq) return;       // already got with the history
+        lastSeq = seq;
+      }
+      text = text.substring(tag[0].length);
+    }
+    lines[(first + count) % MAX_LINES] = [text, cls];
+    if (count < MAX_LINES) count++;
+    else first = (first + 1) % MAX_LINES;
+    stats.lines++;
+  }
 
-  function manageWebSocket() {
+  function append(data) {
+    pending.push(data);
+    stats.frames++;
+    if (!scheduled) {
+      scheduled = true;
+      requestAnimationFrame(flush);
+    }
+  }
 
-    ws = new WebSocket("ws://" + document.location.host + "/webserialws");
-//   ws = new WebSocket("ws://192.168.1.100/webserialws");
+  // all frames of an animation frame are split in lines and rendered at once
+  function flush() {
+    scheduled = false;
+    var text = (partial || "") + pending.join("");
+    pending = [];
+    var parts = text.split("\n");
+    partial = parts.pop();
+    if (partial === "") partial = null;
+    parts.forEach(pushLine);
+    render(!state.lock);
+  }
 
-    ws.onopen = function() {
-        ws.send('Hi this is web client.');  
-        connected = true;      
-    };
+  function total() { return count + (partial ? 1 : 0); }
 
-    ws.onmessage = function(event) {
-      const zeroPad = (num, places) => String(num).padStart(places, '0')
-
-      var today = new Date() - startTime;
-      var milli = (((today%1000)/100)|0);
-      var sec = ((today/1000)|0);
-      var delta = '';
-      if (time) {
-        delta = zeroPad(sec,3)+'.'+milli.toFixed(0) + ' - ';
-      }
+  function line(i) {
+    if (i < count) return lines[(first + i) % MAX_LINES];
+    return [partial, "lx"];
+  }
+
+  // only the visible rows are in the DOM
+  function render(follow) {
+    var start = performance.now();
+    var n = total();
+    spacer.style.height = (n * ROW) + "px";
+    if (follow) view.scrollTop = n * ROW;
+
+    var from = Math.max(0, Math.floor(view.scrollTop / ROW) - 5);
+    var to = Math.min(n, from + Math.ceil(view.clientHeight / ROW) + 10);
+    rows.style.top = (from * ROW) + "px";
+
+    var html = [];
+    for (var i = from; i < to; i++) {
+      var l = line(i);
+      var div = document.createElement('div');
+      div.className = l[1];
+      div.textContent = l[0];
+      html.push(div);
+    }
+    rows.replaceChildren(...html);
+    stats.renders++;
+    stats.renderMs += performance.now() - start;
+  }
+
+  view.addEventListener('scroll', () => render(false));
+  window.addEventListener('resize', () => render(false));
 
-      document.getElementById('messages').value += delta + event.data;
+  function manageWebSocket() {
+    // after a reconnection only the records not received yet are sent back
+    ws = new WebSocket("ws://" + document.location.host + "/webserialws?since=" + lastSeq);
 
-      if (!lock) {
-        document.getElementById('messages').scrollTop = document.getElementById('messages').scrollHeight;
-      } 
+    ws.onopen = function() {
+      append(getTime() + "WMSG - Connected ...\n");
+      connected = true;
     };
 
     ws.onclose = function(event) {
-      const zeroPad = (num, places) => String(num).padStart(places, '0')
-
-      var today = new Date() - startTime;
-      var milli = (((today%1000)/100)|0);
-      var sec = ((today/1000)|0);
-      var delta = '';
-      if (time) {
-        delta = zeroPad(sec,3)+'.'+milli.toFixed(0) + ' - ';
-      }
-      document.getElementById('messages').value += delta + "Disconnected ...\n";
-
+      append(getTime() + "WMSG - Disconnected ...\n");
       ws = null;
       connected = false;
-      setTimeout(manageWebSocket, 500);       
+      setTimeout(manageWebSocket, 500);
     };
 
-
-
-    setInterval( () => {
-      if ((ws != null) && (ws.readyState == 1)) {
-        ws.send('');   // heart beat
+    ws.onmessage = function(event) {
+      if (event.data == "#TimeON")  { setState('time', true);  return; }
+      if (event.data == "#DebugON") { setState('debug', true); return; }
+      if (event.data.startsWith("#Modules ")) { showModules(event.data.substring(9)); return; }
+      if (event.data.startsWith("#Seq ")) {     // records follow from there, a rebooted device starts again from 0
+        if (scheduled) flush();
+        lastSeq = Number(event.data.substring(5));
+        return;
       }
-    }, 5000); 
+      if (event.data == "#Stats")   { ws.send("#Stats# " + JSON.stringify(stats)); return; }
+      append(event.data);
+    };
   };
- 
-  var menu = false;
-  var debug = true;
-  var time = false; 
-  var lock = true;
-  
 
-  myDebug();
-  myTime();
-  myLock();
-  document.getElementById("IDreset").parentElement.style.backgroundColor="#B370FF";
-
-  manageWebSocket();
-
-  document.getElementById('idMessage').addEventListener('keyup', function(event) {
-    if (event.keyCode === 13) {
-     event.preventDefault();
-     myBtn();
-     //document.getElementById('idSend').click();
-    }
-  });
-
-  document.getElementById('IDdial').addEventListener('click', function(event) {
-      //event.preventDefault();
-     }
-  );
-
-
-
-  function myBtn() {
-    if (connected) ws.send(document.getElementById('idMessage').value);
-  };
+  setInterval( () => {
+    if ((ws != null) && (ws.readyState == 1)) ws.send('');    // heart beat
+  }, 5000);
 
+  function setState(name, value) {
+    state[name] = value;
+    document.getElementById(name).className = value ? "on" : "";
+  }
 
-  function myDial() {
-    menu = !menu;
-    console.log(menu);
-    if (menu) {
-      document.getElementById("IDmenu").setAttribute("icon","md-close") ;
-      document.getElementById("IDdial").style.opacity="1.0"
-    }
-    else {
-      document.getElementById("IDmenu").setAttribute("icon","md-menu") ;
-      document.getElementById("IDdial").style.opacity="0.5"
-    }
+  function toggle(name) {
+    setState(name, !state[name]);
+    if (name == 'debug') sendCmd(state.debug ? "DebugON" : "DebugOFF");
+    if (name == 'time')  sendCmd(state.time ? "TimeON" : "TimeOFF");
+    if (name == 'lock')  render(!state.lock);
   }
- 
-  function myDebug() {
-    debug = !debug;
-    console.log("On Debug"+debug);
-
-    if (debug ) {
-      document.getElementById("IDdebug").parentElement.style.backgroundColor="#3399ff";
-      sendCmd("DebugON");
-    }
-    else {
-      document.getElementById("IDdebug").parentElement.style.backgroundColor="gray";
-      sendCmd("DebugOFF");
-    }
+
+  function sendMsg() {
+    if (connected) ws.send(document.getElementById('msg').value);
   }
 
-  function myTime() {
-    time = !time;
-    console.log("On Time"+time);
+  // the device answers with the saved records holding all the words
+  function findMsg() {
+    if (connected) ws.send('#Find ' + document.getElementById('msg').value + '#');
+  }
 
-    if (time ) document.getElementById("IDtime").parentElement.style.backgroundColor="#3399ff";
-    else document.getElementById("IDtime").parentElement.style.backgroundColor="gray";
-   }
+  document.getElementById('msg').addEventListener('keyup', function(event) {
+    if (event.key === "Enter") sendMsg();
+  });
 
-  function myDelete() {
-    console.log("On Delete");
-    document
-      .getElementById('myDelete-dialog')
-      .show();
+  function showModules(list) {
+    var html = "";
+    list.split(",").forEach( (item) => {
+      var kv = item.split("=");
+      html += '<div>' + kv[0] + ' <select onchange="ws.send(\'#Level ' + kv[0] + ' \' + this.value + \'#\')">';
+      levels.forEach( (name, i) => {
+        html += '<option value="' + i + '"' + (i == kv[1] ? ' selected' : '') + '>' + name + '</option>';
+      });
+      html += '</select></div>';
+    });
+    document.getElementById('modules').innerHTML = html;
   }
 
-  function myReset() {
-    console.log("On Reset");
-    document
-      .getElementById('myReset-dialog')
-      .show();
+  function showDialog(id) {
+    document.getElementById(id).showModal();
   }
 
+  // history saved to flash by the device after a critical message
+  function showSnapshots() {
+    var base = document.location.pathname.replace(/\/$/, '');
+    fetch(base + '/snapshots').then((r) => r.json()).then((list) => {
+      var html = list.length ? '' : 'None';
+      list.sort((a, b) => b.n - a.n).forEach((s) => {
+        html += '<div><a href="' + base + '/snapshot?n=' + s.n + '">snap' + s.n + '.log</a> ' + s.size + ' bytes</div>';
+      });
+      document.getElementById('snaplist').innerHTML = html;
+      showDialog('snapshots');
+    }).catch(() => append(getTime() + "WMSG - No snapshot support\n"));
+  }
 
-  function hideAlertDialog(param) {
-    document
-      .getElementById('myDelete-dialog')
-      .hide();
-
-    document
-      .getElementById('myReset-dialog')
-      .hide();
-    
-    if (param=="Logs") document.getElementById("messages").value = "";
+  function hideDialog(param) {
+    ['levels', 'snapshots', 'delete', 'reset'].forEach( (id) => document.getElementById(id).close() );
+    if (param == "Logs") {
+      first = count = 0;
+      partial = null;
+      render(true);
+    }
     sendCmd(param);
-  };
-
-  function sendCmd(param) {
-    if (connected) {
-      if (param=="Crashs")    ws.send('#CleanCrash#');
-      if (param=="Reset")     ws.send('#Reset#');
-      if (param=="DebugON")   ws.send('#DebugON#');
-      if (param=="DebugOFF")  ws.send('#DebugOFF#');
-    } 
   }
 
-  function myLock() {
-    lock = !lock;
-    console.log("On Lock"+lock);
-
-    if (lock) {
-      document.getElementById("IDlock").parentElement.style.backgroundColor="#3399ff";
-      document.getElementById("IDlock").setAttribute("icon","md-lock-outline") ;
-    }
-    else {
-      document.getElementById("IDlock").parentElement.style.backgroundColor="gray";
-      document.getElementById("IDlock").setAttribute("icon","md-lock-open") ;
+  function sendCmd(param) {
+    if (!connected) return;
+    if (param == "Crashs")    ws.send('#CleanCrash#');
+    if (param == "DebugON")   ws.send('#DebugON#');
+    if (param == "DebugOFF")  ws.send('#DebugOFF#');
+    if (param == "TimeON")    ws.send('#TimeON#');
+    if (param == "TimeOFF")   ws.send('#TimeOFF#');
+    if (param == "Reset") {
+      ws.send('#Reset#');
+      setState('debug', false);
+      setState('time', false);
     }
   }
 
+  setState('debug', false);
+  setState('time', true);
+  setState('lock', false);
+  manageWebSocket();
 </script>
- * 
+
  */
   
 
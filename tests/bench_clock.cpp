@@ -0,0 +1,34 @@
+/**
+ * Cost of the time stamp prefix: LogClock, cached per second, against formatting the whole
+ * prefix with localtime_r/strftime for every message as the sinks did before.
+ */
+#include "host.h"
+#include "LogClock.h"
+#include <time.h>
+
+static char line[LOG_PREFIX_SIZE];
+
+static void strftimePrefix(uint32_t epochOffset, uint32_t ms) {
+    time_t    t = epochOffset + ms / 1000;
+    struct tm tm;
+    localtime_r(&t, &tm);
+    size_t n = strftime(line, sizeof(line), "%H:%M:%S", &tm);
+    snprintf(line + n, sizeof(line) - n, ".%03u - ", (unsigned) (ms % 1000));
+}
+
+int main() {
+    setenv("TZ", "UTC", 1);
+    LogTime.setTime(1700000000, 250, 10000);
+
+    uint32_t ms    = 10000;
+    double   same  = hostTime(1000000, [&]() { LogTime.getPrefix(ms); ms = 10000 + (ms + 1) % 500; });
+    double   every = hostTime(100000,  [&]() { LogTime.getPrefix(ms); ms += 1000; });
+    double   full  = hostTime(100000,  [&]() { strftimePrefix(LogTime.getEpochOffset(), ms); ms += 7; });
+
+    printf("%-34s %8s\n", "prefix", "ns");
+    printf("%-34s %8.1f\n", "LogClock, same second", same);
+    printf("%-34s %8.1f\n", "LogClock, new second every call", every);
+    printf("%-34s %8.1f\n", "localtime_r + strftime each call", full);
+    printf("sample: \"%s\"\n", LogTime.getPrefix(10000));
+    return 0;
+}
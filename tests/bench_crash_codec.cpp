@@ -0,0 +1,55 @@
+/**
+ * Compression ratio and encoding cost of CrashStackCodec on the stack images of data/stacks
+ * The cost is measured on the host, the ESP8266 runs the same loop at about 1/20 of the speed.
+ */
+#include "host.h"
+#include "EspSaveCrashND.h"
+
+#define REGION      0x200       // default EspSaveCrash region
+#define REGION_BIG  0x1000      // whole EEPROM sector
+
+// whole stack, as the crash callback encodes it
+static uint16_t encode(const HostStack& s, uint8_t* out, uint16_t size) {
+    CrashStackEncoder encoder(out, size, s.start);
+    for (uint32_t w : s.words) if (!encoder.add(w)) break;
+    return encoder.length();
+}
+
+// code only: pairs of (words skipped, code address)
+static uint16_t encodeCode(const HostStack& s, uint8_t* out, uint16_t size) {
+    CrashStackEncoder encoder(out, size);
+    size_t next = 0;
+    for (size_t i = 0; i < s.words.size(); i++) {
+        if (!EspSaveCrash::isCodeAddress(s.words[i])) continue;
+        if (!encoder.add(i - next) || !encoder.add(s.words[i])) break;
+        next = i + 1;
+    }
+    return encoder.length();
+}
+
+// data sets of that many stack bytes the region holds, up to the index entries
+static double fits(size_t region, size_t stackBytes) {
+    double n = (double) (region - SAVE_CRASH_DATA_SETS(region)) / (SAVE_CRASH_STACK_TRACE + stackBytes);
+    return std::min(n, (double) SAVE_CRASH_RECORDS(region));
+}
+
+int main() {
+    std::vector<HostStack> stacks = hostReadStacks("data/stacks");
+    static uint8_t         out[8192];
+
+    printf("index and header: %u bytes of 0x%x, %u of 0x%x, data set header %u bytes\n",
+           SAVE_CRASH_DATA_SETS(REGION), REGION, SAVE_CRASH_DATA_SETS(REGION_BIG), REGION_BIG, SAVE_CRASH_STACK_TRACE);
+    printf("%-22s %6s %8s %6s %6s %8s   crashes per region: 0x200 raw/encoded/code, 0x1000 raw/encoded/code\n",
+           "stack", "words", "encoded", "ratio", "code", "ns/word");
+    for (const HostStack& s : stacks) {
+        size_t   raw  = s.words.size() * 4;
+        uint16_t len  = encode(s, out, sizeof(out));
+        uint16_t code = encodeCode(s, out, sizeof(out));
+        double   ns   = hostTime(2000, [&]() { encode(s, out, sizeof(out)); }) / s.words.size();
+
+        printf("%-22s %6zu %8u %5.0f%% %6u %8.1f   %4.2f / %4.2f / %4.2f   %4.2f / %4.2f / %4.2f\n", s.name.c_str(), s.words.size(), len,
+               100.0 * len / raw, code, ns, fits(REGION, raw), fits(REGION, len), fits(REGION, code),
+               fits(REGION_BIG, raw), fits(REGION_BIG, len), fits(REGION_BIG, code));
+    }
+    return 0;
+}
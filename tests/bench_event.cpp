@@ -0,0 +1,33 @@
+/**
+ * Cost of rendering a structured event (LogEvent, LogWriter) against snprintf of the same line,
+ * for the text, logfmt and JSON renderings.
+ */
+#include "host.h"
+#include "LogEvent.h"
+
+static char line[LOG_EVENT_SIZE * 2];
+
+// defined with the sinks in LoggerDev.cpp, not linked here
+LogEvent::~LogEvent() {}
+
+int main() {
+    LogEvent event(NULL, 6, "motor");
+    event.kv("rpm", 1200).kv("temp", 41.5).kv("ok", true).kv("name", "left wheel");
+
+    const char* names[] = { "text", "logfmt", "json" };
+    const char* fmts[]  = { "motor rpm=%d temp=%.1f ok=%s name=%s\n",
+                            "event=motor pri=%d rpm=%d temp=%.1f ok=%s name=\"%s\"\n",
+                            "{\"event\":\"motor\",\"pri\":%d,\"rpm\":%d,\"temp\":%.1f,\"ok\":%s,\"name\":\"%s\"}\n" };
+
+    printf("%-8s %10s %10s   %s\n", "format", "event ns", "printf ns", "line");
+    for (uint8_t f = LOG_FORMAT_TEXT; f <= LOG_FORMAT_JSON; f++) {
+        double ev = hostTime(200000, [&]() { event.render(line, sizeof(line), f); });
+        double pf = hostTime(200000, [&]() {
+            if (f == LOG_FORMAT_TEXT) snprintf(line, sizeof(line), fmts[f], 1200, 41.5, "true", "left wheel");
+            else                      snprintf(line, sizeof(line), fmts[f], 6, 1200, 41.5, "true", "left wheel");
+        });
+        event.render(line, sizeof(line), f);
+        printf("%-8s %10.1f %10.1f   %s", names[f], ev, pf, line);
+    }
+    return 0;
+}
@@ -0,0 +1,43 @@
+/**
+ * Cost of LogFmt::format, as Log.print() calls it with its tagged arguments, against vsnprintf,
+ * as Log.printf() calls it with a va_list, on typical log lines.
+ */
+#include "host.h"
+#include <stdarg.h>
+#include "LogFormat.h"
+
+static char line[256];
+
+static int formatVa(const char* fmt, ...) {
+    va_list args;
+    va_start(args, fmt);
+    int len = vsnprintf(line, sizeof(line), fmt, args);
+    va_end(args);
+    return len;
+}
+
+template<typename... A> static size_t formatArgs(const char* fmt, const A&... args) {
+    LogArg    list[] = { LogArg(args)... };
+    LogWriter w(line, sizeof(line));
+    return LogFmt::format(w, fmt, list, sizeof...(A));
+}
+
+template<typename... A> static void compare(const char* fmt, const A&... args) {
+    double va  = hostTime(200000, [&]() { formatVa(fmt, args...); });
+    double lf  = hostTime(200000, [&]() { formatArgs(fmt, args...); });
+    formatArgs(fmt, args...);
+    printf("%-34s %9.1f %9.1f %6.2f   %s\n", fmt, lf, va, va / lf, line);
+}
+
+int main() {
+    printf("%-34s %9s %9s %6s   %s\n", "format", "LogFmt ns", "vsnprintf", "ratio", "line");
+    compare("heap %u bytes", 31544u);
+    compare("%s: %d", "wifi", -72);
+    compare("%s:%d %s", "main.cpp", 142, "setup done");
+    compare("addr %08x len %u", 0x3ffe8a20u, 128u);
+    compare("temp %.1f C hum %.0f %%", 21.4375, 48.2);
+    compare("%-10s|%5d|%-5x|", "motor", 1200, 255);
+    compare("uptime %lu ms, %ld loops", 123456789UL, -42L);
+    compare("%e", 0.000123);
+    return 0;
+}
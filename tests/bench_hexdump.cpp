@@ -0,0 +1,71 @@
+/**
+ * Cost of rendering 1 KB of hex: a crash stack as "%08x " per word and a Log.hexdump() as "%02x " per byte
+ * with snprintf, against LogHex as EspSaveCrash::print and Log.hexdump() use it.
+ * Built twice, bench_hexdump_scalar with the table as on the ESP and bench_hexdump with SSE2.
+ */
+#include "host.h"
+#include "LogFormat.h"
+
+static uint32_t stack[256];
+static uint8_t  bytes[1024];
+static char     out[8192];
+
+static void printfStack() {
+    size_t o = 0;
+    for (int i = 0; i < 256; i++) {
+        if (!(i & 3)) o += snprintf(out + o, 32, "%08x: ", 0x3ffe0000 + i * 4);
+        o += snprintf(out + o, 16, "%08x ", stack[i]);
+        if ((i & 3) == 3) out[o++] = '\n';
+    }
+    out[o] = '\0';
+}
+
+static void hexStack() {
+    char* p = out;
+    for (int i = 0; i < 256; i++) {
+        if (!(i & 3)) {
+            p    = LogHex::word(p, 0x3ffe0000 + i * 4);
+            *p++ = ':';
+            *p++ = ' ';
+        }
+        p    = LogHex::word(p, stack[i]);
+        *p++ = ' ';
+        if ((i & 3) == 3) *p++ = '\n';
+    }
+    *p = '\0';
+}
+
+static void printfDump() {
+    size_t o = 0;
+    for (int i = 0; i < 1024; i++) o += snprintf(out + o, 8, "%02x ", bytes[i]);
+}
+
+static void hexDump() {
+    char* p = out;
+    for (int i = 0; i < 1024; i += 16) p += LogHex::line(p, 0x3ffe0000 + i, bytes + i, 16);
+}
+
+int main() {
+    for (int i = 0; i < 256; i++) stack[i] = i * 2654435761u;
+    memcpy(bytes, stack, sizeof(bytes));
+
+    // both stack renderings give the same text
+    std::string expected;
+    printfStack();
+    expected = out;
+    hexStack();
+    if (expected != out) printf("stack rows differ from printf\n");
+
+#ifdef LOG_HEX_SSE2
+    printf("%-34s %8s\n", "1 KB, LogHex SSE2", "ns/byte");
+#else
+    printf("%-34s %8s\n", "1 KB, LogHex table", "ns/byte");
+#endif
+    printf("%-34s %8.2f\n", "stack, snprintf %08x per word", hostTime(20000, printfStack) / 1024);
+    printf("%-34s %8.2f\n", "stack, LogHex::word", hostTime(20000, hexStack) / 1024);
+    printf("%-34s %8.2f\n", "hexdump, snprintf %02x per byte", hostTime(20000, printfDump) / 1024);
+    printf("%-34s %8.2f\n", "hexdump, LogHex::line", hostTime(20000, hexDump) / 1024);
+    LogHex::line(out, 0x3ffe0000, bytes, 16);
+    printf("sample: %s", out);
+    return 0;
+}
@@ -0,0 +1,51 @@
+/**
+ * Records an history of a given size holds on average, with and without compression, and what adding and reading cost.
+ * The log is synthetic: WiFi, MQTT, heap, relay and HTTP lines with varying numbers.
+ * The memory includes the compression scratch, as initBuffer() gives it.
+ */
+#include "host.h"
+#include "LogHistory.h"
+
+static int line(char* m, size_t size, int i) {
+    static const char* msgs[] = { "WiFi connected, rssi %d dBm\n", "MQTT publish topic home/sensor/%d payload {\"t\":%d.%d}\n",
+                                  "Heap free %d bytes, max block %d\n", "Relay %d switched %s\n", "HTTP GET /api/status 200 %d ms\n" };
+    int r = rand();
+    switch (i % 5) {
+        case 0:  return snprintf(m, size, msgs[0], -50 - r % 30);
+        case 1:  return snprintf(m, size, msgs[1], r % 8, 20 + r % 5, r % 10);
+        case 2:  return snprintf(m, size, msgs[2], 20000 + r % 5000, 8000 + r % 3000);
+        case 3:  return snprintf(m, size, msgs[3], r % 4, (r & 1) ? "on" : "off");
+        default: return snprintf(m, size, msgs[4], r % 300);
+    }
+}
+
+int main() {
+    static uint8_t memory[32768];
+    char           m[128];
+
+    printf("%6s %8s %8s %10s %8s %12s\n", "bytes", "compress", "records", "records/KB", "add ns", "read ns/rec");
+    for (size_t size : { 3072, 4096, 5120, 6144, 8192, 16384, 32768 }) {
+        for (bool compress : { false, true }) {
+            LogHistory history(memory, size, compress);
+            uint32_t   seq = 0;
+
+            srand(1);
+            double add = hostTime(5000, [&]() { seq++; history.add(seq, seq * 137, 6, m, line(m, sizeof(m), seq)); });
+
+            // records held, averaged over the wrap cycle of the ring
+            uint32_t records = 0, samples = 0;
+            for (int i = 0; i < 2000; i++) {
+                seq++;
+                history.add(seq, seq * 137, 6, m, line(m, sizeof(m), seq));
+                if (i % 7) continue;
+                history.forEach(0, [&](const tHistoryRecord&, const char*) -> bool { records++; return true; });
+                samples++;
+            }
+            records /= samples;
+            double read = hostTime(20, [&]() { history.forEach(0, [](const tHistoryRecord&, const char*) -> bool { return true; }); }) / records;
+
+            printf("%6zu %8s %8u %10u %8.1f %12.1f\n", size, compress ? "yes" : "no", (unsigned) records, (unsigned) (records * 1024 / size), add, read);
+        }
+    }
+    return 0;
+}
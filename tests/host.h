@@ -0,0 +1,76 @@
+// Helpers shared by the host tests and benchmarks
+#ifndef HOST_TEST_H
+#define HOST_TEST_H
+
+#include <stdio.h>
+#include <string.h>
+#include <stdint.h>
+#include <string>
+#include <vector>
+#include <chrono>
+#include <dirent.h>
+#include <algorithm>
+
+static int hostFailures = 0;
+
+#define CHECK(cond) do { if (!(cond)) { printf("%s:%d: CHECK failed: %s\n", __FILE__, __LINE__, #cond); hostFailures++; } } while (0)
+
+// exit status of a test, with a one line summary
+static int hostResult(const char* name) {
+    printf("%s: %s\n", name, hostFailures ? "FAILED" : "ok");
+    return hostFailures ? 1 : 0;
+}
+
+// nanoseconds per call of fn, run n times after a warm up
+template<typename F> double hostTime(int n, F fn) {
+    fn();
+    auto start = std::chrono::steady_clock::now();
+    for (int i = 0; i < n; i++) fn();
+    return std::chrono::duration<double, std::nano>(std::chrono::steady_clock::now() - start).count() / n;
+}
+
+// Stack image as printed between ">>>stack>>>" and "<<<stack<<<" by the ESP8266 core or by EspSaveCrash
+struct HostStack {
+    std::string           name;
+    uint32_t              start = 0;
+    std::vector<uint32_t> words;
+};
+
+static bool hostReadStack(const std::string& path, HostStack& stack) {
+    FILE* f = fopen(path.c_str(), "r");
+    if (!f) return false;
+
+    char line[256];
+    bool inside = false;
+    while (fgets(line, sizeof(line), f)) {
+        if (strstr(line, ">>>stack>>>")) inside = true;
+        else if (strstr(line, "<<<stack<<<")) break;
+        else if (inside) {
+            uint32_t address, w[4];
+            int      n = sscanf(line, "%x: %x %x %x %x", &address, &w[0], &w[1], &w[2], &w[3]);
+            if (n < 2) continue;
+            if (stack.words.empty()) stack.start = address;
+            stack.words.insert(stack.words.end(), w, w + n - 1);
+        }
+    }
+    fclose(f);
+    return !stack.words.empty();
+}
+
+// every *.txt stack image of a directory, sorted by name
+static std::vector<HostStack> hostReadStacks(const char* dir) {
+    std::vector<HostStack> stacks;
+    DIR* d = opendir(dir);
+    if (!d) return stacks;
+    while (struct dirent* e = readdir(d)) {
+        std::string name = e->d_name;
+        HostStack   stack;
+        stack.name = name;
+        if ((name.size() > 4) && (name.compare(name.size() - 4, 4, ".txt") == 0) && (hostReadStack(std::string(dir) + "/" + name, stack))) stacks.push_back(stack);
+    }
+    closedir(d);
+    std::sort(stacks.begin(), stacks.end(), [](const HostStack& a, const HostStack& b) { return a.name < b.name; });
+    return stacks;
+}
+
+#endif
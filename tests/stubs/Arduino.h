@@ -0,0 +1,76 @@
+// Host stand-in for the parts of the Arduino core used by the library, for tests/ only
+#ifndef HOST_ARDUINO_H
+#define HOST_ARDUINO_H
+
+#include <stdint.h>
+#include <stddef.h>
+#include <string.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <stdarg.h>
+#include <math.h>
+#include <ctype.h>
+#include <strings.h>
+#include <algorithm>
+
+typedef uint8_t byte;
+
+#define PROGMEM
+#define IRAM_ATTR
+#define ICACHE_RAM_ATTR
+#define ICACHE_FLASH_ATTR
+#define constrain(amt,low,high) ((amt)<(low)?(low):((amt)>(high)?(high):(amt)))
+
+extern unsigned long hostMillis;        // time seen by the library, set by the tests
+inline unsigned long millis()           { return hostMillis; }
+inline unsigned long micros()           { return hostMillis * 1000; }
+inline void yield()                     {}
+inline void delay(unsigned long ms)     { hostMillis += ms; }
+inline void noInterrupts()              {}
+inline void interrupts()                {}
+inline uint32_t xt_rsil(int)            { return 0; }
+inline void xt_wsr_ps(uint32_t)         {}
+
+class String {
+public:
+    String(const char* s = "") : s(s) {}
+    const char* c_str() const           { return s; }
+    size_t      length() const          { return strlen(s); }
+private:
+    const char* s;
+};
+
+class Print {
+public:
+    virtual ~Print() {}
+    virtual size_t write(uint8_t) = 0;
+    virtual size_t write(const uint8_t* buffer, size_t size) { size_t n = 0; while (size--) n += write(*buffer++); return n; }
+    size_t write(const char* s)                 { return write((const uint8_t*) s, strlen(s)); }
+    size_t write(const char* b, size_t n)       { return write((const uint8_t*) b, n); }
+    virtual int  availableForWrite()            { return 0; }
+    virtual void flush()                        {}
+    size_t printf(const char* format, ...) __attribute__ ((format (printf, 2, 3)));
+    size_t print(const char* s)                 { return write(s); }
+    size_t print(char c)                        { return write((uint8_t) c); }
+    size_t print(unsigned long n)               { char b[24]; return write(b, snprintf(b, sizeof(b), "%lu", n)); }
+    size_t println(const char* s = "")          { return write(s) + write("\n"); }
+};
+
+class HardwareSerial : public Print {
+public:
+    void   begin(unsigned long)                 {}
+    size_t write(uint8_t c) override;
+    size_t write(const uint8_t* buffer, size_t size) override;
+    int    availableForWrite() override;
+    using Print::write;
+};
+extern HardwareSerial Serial;
+
+class EspClass {
+public:
+    uint32_t getCycleCount();
+    uint32_t getFreeHeap()                      { return 40000; }
+};
+extern EspClass ESP;
+
+#endif
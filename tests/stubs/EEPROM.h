@@ -0,0 +1,28 @@
+// Host stand-in for the ESP8266 EEPROM emulation: a flash image and its RAM copy
+#ifndef HOST_EEPROM_H
+#define HOST_EEPROM_H
+
+#include "Arduino.h"
+
+class EEPROMClass {
+public:
+    void            begin(size_t size);
+    uint8_t         read(int address)                   { return ram[address]; }
+    void            write(int address, uint8_t value)   { ram[address] = value; }
+    template<typename T> T& get(int address, T& t)      { memcpy(&t, ram + address, sizeof(T)); return t; }
+    template<typename T> const T& put(int address, const T& t) { memcpy(ram + address, &t, sizeof(T)); return t; }
+    bool            commit()                            { memcpy(flash, ram, size); return true; }
+    bool            end()                               { commit(); size = 0; return true; }
+    uint8_t*        getDataPtr()                        { return ram; }
+    const uint8_t*  getConstDataPtr() const             { return ram; }
+    size_t          length()                            { return size; }
+                    EEPROMClass()                       { memset(flash, 0xFF, sizeof(flash)); }
+
+    uint8_t         flash[4096];
+private:
+    uint8_t         ram[4096];
+    size_t          size = 0;
+};
+extern EEPROMClass EEPROM;
+
+#endif
@@ -0,0 +1,40 @@
+// Host definitions behind stubs/Arduino.h and stubs/EEPROM.h
+#include "Arduino.h"
+#include "EEPROM.h"
+#include <chrono>
+
+unsigned long hostMillis = 1000;
+EspClass      ESP;
+EEPROMClass   EEPROM;
+
+uint32_t EspClass::getCycleCount() {
+    return (uint32_t) std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now().time_since_epoch()).count();
+}
+
+void EEPROMClass::begin(size_t size) {
+    this->size = size;
+    memcpy(ram, flash, size);
+}
+
+size_t Print::printf(const char* format, ...) {
+    char    buf[512];
+    va_list args;
+    va_start(args, format);
+    int n = vsnprintf(buf, sizeof(buf), format, args);
+    va_end(args);
+    return write((const uint8_t*) buf, std::min(n, (int) sizeof(buf) - 1));
+}
+
+HardwareSerial Serial;
+
+size_t HardwareSerial::write(uint8_t c) {
+    return fwrite(&c, 1, 1, stdout);
+}
+
+size_t HardwareSerial::write(const uint8_t* buffer, size_t size) {
+    return fwrite(buffer, 1, size, stdout);
+}
+
+int HardwareSerial::availableForWrite() {
+    return 128;
+}
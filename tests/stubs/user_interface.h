@@ -0,0 +1,10 @@
+// Host stand-in for the ESP8266 SDK reset information
+#ifndef HOST_USER_INTERFACE_H
+#define HOST_USER_INTERFACE_H
+
+#include <stdint.h>
+
+enum rst_reason { REASON_DEFAULT_RST = 0, REASON_WDT_RST, REASON_EXCEPTION_RST, REASON_SOFT_WDT_RST, REASON_SOFT_RESTART, REASON_DEEP_SLEEP_AWAKE, REASON_EXT_SYS_RST };
+struct rst_info { uint32_t reason, exccause, epc1, epc2, epc3, excvaddr, depc; };
+
+#endif
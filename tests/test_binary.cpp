@@ -0,0 +1,96 @@
+// LogBinary through a slow LogSerial, decoded by tools/logdecode.py: long texts, dropped format strings and records
+#include "host.h"
+#include "LogBinary.h"
+#include <stdarg.h>
+
+#define CAPTURE "build/test_binary.bin"
+
+// UART capturing what it sends, taking fifo bytes until the test lets it send more
+class CaptureUart : public HardwareSerial {
+public:
+    std::string out;
+    int         fifo = 4096;
+
+    size_t write(uint8_t c) override { return write(&c, 1); }
+    size_t write(const uint8_t* buffer, size_t size) override {
+        out.append((const char*) buffer, size);
+        fifo -= size;
+        return size;
+    }
+    int availableForWrite() override { return std::max(fifo, 0); }
+};
+
+static CaptureUart uart;
+static LogSerial   serial(uart);
+static LogBinary   binary;
+static uint8_t     ring[256];
+
+// as Logger does: packed when possible, text otherwise
+static void log(uint16_t seq, uint8_t pri, const char* fmt, ...) {
+    va_list argp;
+    va_start(argp, fmt);
+    bool packed = binary.printf(seq, pri, fmt, argp);
+    va_end(argp);
+    if (packed) return;
+
+    char text[512];
+    va_start(argp, fmt);
+    int n = vsnprintf(text, sizeof(text), fmt, argp);
+    va_end(argp);
+    binary.text(seq, pri, text, n);
+}
+
+static std::string decode() {
+    FILE* f = fopen(CAPTURE, "wb");
+    fwrite(uart.out.data(), 1, uart.out.size(), f);
+    fclose(f);
+
+    std::string text;
+    char        line[512];
+    FILE*       p = popen("python3 ../tools/logdecode.py " CAPTURE, "r");
+    if (!p) return text;
+    while (fgets(line, sizeof(line), p)) text += line;
+    pclose(p);
+    return text;
+}
+
+int main() {
+    serial.begin(ring, sizeof(ring));
+    serial.setFramed(true);
+    binary.begin(&serial);
+
+    // a text of several frames comes back whole, UTF-8 characters cut between frames included
+    std::string longText;
+    for (int i = 0; i < 30; i++) longText += "é-" + std::to_string(i) + " ";
+    uart.fifo = 4096;
+    log(1, 6, "%s\n", longText.c_str());       // "%s" of a long string does not fit a frame, sent as text
+
+    // the ring is full: the format string frame is dropped, so the next use sends it again
+    uart.fifo = 0;
+    for (int i = 0; i < 20; i++) log(2 + i, 6, "fill %d\n", i);
+    log(22, 6, "rssi %d dBm\n", -61);
+    CHECK(uart.out.find("rssi") == std::string::npos);
+    uart.fifo = 4096;
+    serial.drain();
+    log(23, 6, "rssi %d dBm\n", -62);
+
+    // the last part of a long text dropped: the decoder marks it truncated
+    uart.fifo = 0;
+    char fill[300];
+    memset(fill, 'x', sizeof(fill));
+    binary.text(24, 4, fill, sizeof(fill));     // the ring takes its first two frames only
+    uart.fifo = 4096;
+    serial.drain();
+    log(25, 6, "end\n");
+
+    std::string text = decode();
+    CHECK(text.find(longText) != std::string::npos);
+    CHECK(text.find("rssi -62 dBm") != std::string::npos);
+    CHECK(text.find("format") == std::string::npos);             // no "<format n not received yet>"
+    CHECK(text.find("records lost>") != std::string::npos);      // the fill and rssi -61 messages dropped
+    CHECK(text.find("x~\n") != std::string::npos);
+    CHECK(text.find("end") != std::string::npos);
+    if (hostFailures) printf("%s", text.c_str());
+
+    return hostResult("test_binary");
+}
@@ -0,0 +1,135 @@
+/**
+ * CrashStackCodec round trip on the stack images of data/stacks, whole stack and code-only data sets
+ * The crash callback reads the stack at its ESP8266 address, the image is mapped there.
+ */
+#include "host.h"
+#include "EspSaveCrashND.h"
+#include <sys/mman.h>
+
+extern "C" void custom_crash_callback(struct rst_info* rst_info, uint32_t stack, uint32_t stack_end);
+
+#define MAP_BASE    0x3fff0000
+#define MAP_SIZE    0x10000
+
+static std::vector<uint32_t> decode(const uint8_t* in, uint16_t len, uint32_t address = 0) {
+    std::vector<uint32_t> words;
+    CrashStackDecoder     decoder(in, len, address);
+    uint32_t              w;
+    while (decoder.next(w)) words.push_back(w);
+    return words;
+}
+
+// the codec alone: everything comes back, a short buffer gives a prefix
+static void roundTrip(const HostStack& s) {
+    static uint8_t out[8192];
+    CrashStackEncoder encoder(out, sizeof(out), s.start);
+    for (uint32_t w : s.words) CHECK(encoder.add(w));
+    CHECK(decode(out, encoder.length(), s.start) == s.words);
+    CHECK(decode(out, encoder.length()) != s.words);        // stack pointers are relative to the address
+
+    CrashStackEncoder shortEncoder(out, 64, s.start);
+    size_t n = 0;
+    while ((n < s.words.size()) && (shortEncoder.add(s.words[n]))) n++;
+    CHECK(n < s.words.size());
+    CHECK(decode(out, shortEncoder.length(), s.start) == std::vector<uint32_t>(s.words.begin(), s.words.begin() + n));
+}
+
+// through the crash callback and the cached region, as on the device
+static void crash(uint8_t* mapped, const HostStack& s, bool codeOnly) {
+    uint32_t end = s.start + 4 * s.words.size();
+    memcpy(mapped + (s.start - MAP_BASE), s.words.data(), 4 * s.words.size());
+
+    EspSaveCrash saver(0x10, 0x800);
+    saver.clear();
+    saver.setCodeOnly(codeOnly);
+    rst_info info = { REASON_EXCEPTION_RST, 28, 0, 0, 0, 0, 0 };
+    custom_crash_callback(&info, s.start, end);
+
+    // the cache given by begin(), as Logger does, or the EEPROM buffer kept open
+    static uint8_t image[0x800];
+    EspSaveCrash reader(0x10, 0x800);
+    if (codeOnly) reader.begin(image);
+    CHECK(reader.count() == 1);
+    const tCrashRecord* record = reader.record(0);
+    CHECK(record->stackStart == s.start);
+    CHECK(record->stackEnd == end);
+    CHECK(record->exceptionCause == 28);
+    CHECK(!(record->format & SAVE_CRASH_FORMAT_TRUNCATED));
+
+    std::vector<uint32_t> words = decode(reader.stack(record), record->stackLength, codeOnly ? 0 : s.start);
+    if (!codeOnly) {
+        CHECK(record->format == SAVE_CRASH_FORMAT_STACK);
+        CHECK(words == s.words);
+        return;
+    }
+
+    // pairs of (words skipped, code address), in stack order, none missed
+    std::vector<uint32_t> expected;
+    size_t next = 0;
+    for (size_t i = 0; i < s.words.size(); i++) {
+        if (!EspSaveCrash::isCodeAddress(s.words[i])) continue;
+        expected.push_back(i - next);
+        expected.push_back(s.words[i]);
+        next = i + 1;
+    }
+    CHECK(record->format == SAVE_CRASH_FORMAT_CODE);
+    CHECK(words == expected);
+    CHECK(record->stackLength * 2 < 4 * s.words.size());
+    printf("  %-20s %4zu stack words, %3zu code addresses in %4u bytes\n", s.name.c_str(), s.words.size(), expected.size() / 2, record->stackLength);
+}
+
+// a data set that does not fit before the end of the ring wraps and evicts the oldest in full,
+// only one bigger than the whole ring is truncated
+static void wrap(uint8_t* mapped, const HostStack& s) {
+    uint32_t end = s.start + 4 * s.words.size();
+    CrashStackEncoder measure(NULL, 0x1000, s.start);
+    for (uint32_t w : s.words) measure.add(w);
+
+    // room for two and a half data sets, the third one does not fit after the second
+    uint16_t size = SAVE_CRASH_DATA_SETS(0x800) + (SAVE_CRASH_STACK_TRACE + measure.length()) * 5 / 2;
+    memcpy(mapped + (s.start - MAP_BASE), s.words.data(), 4 * s.words.size());
+
+    EspSaveCrash saver(0x10, size);
+    saver.clear();
+    saver.setCodeOnly(false);
+    for (uint8_t cause = 1; cause <= 3; cause++) {
+        rst_info info = { REASON_EXCEPTION_RST, cause, 0, 0, 0, 0, 0 };
+        custom_crash_callback(&info, s.start, end);
+    }
+    EspSaveCrash reader(0x10, size);
+    CHECK(reader.count() == 2);
+    if (reader.count() != 2) return;
+    CHECK(reader.record(0)->exceptionCause == 3);
+    CHECK(reader.record(1)->exceptionCause == 2);
+    for (int k = 0; k < reader.count(); k++) {
+        const tCrashRecord* record = reader.record(k);
+        CHECK(record->format == SAVE_CRASH_FORMAT_STACK);
+        CHECK(decode(reader.stack(record), record->stackLength, s.start) == s.words);
+    }
+
+    EspSaveCrash small(0x10, 0x100);
+    small.clear();
+    rst_info info = { REASON_EXCEPTION_RST, 4, 0, 0, 0, 0, 0 };
+    custom_crash_callback(&info, s.start, end);
+    CHECK(small.count() == 1);
+    if (small.count() != 1) return;
+    const tCrashRecord* record = small.record(0);
+    uint16_t            room   = 0x100 - SAVE_CRASH_DATA_SETS(0x100) - SAVE_CRASH_STACK_TRACE;
+    CHECK(record->format == (SAVE_CRASH_FORMAT_STACK | SAVE_CRASH_FORMAT_TRUNCATED));
+    CHECK((record->stackLength <= room) && (record->stackLength + 5 > room));
+}
+
+int main() {
+    std::vector<HostStack> stacks = hostReadStacks("data/stacks");
+    CHECK(!stacks.empty());
+    for (const HostStack& s : stacks) roundTrip(s);
+
+    void* mapped = mmap((void*) MAP_BASE, MAP_SIZE, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS | MAP_FIXED_NOREPLACE, -1, 0);
+    if (mapped != (void*) MAP_BASE) printf("  stack address range not available, crash callback not tested\n");
+    else for (const HostStack& s : stacks) {
+        crash((uint8_t*) mapped, s, false);
+        crash((uint8_t*) mapped, s, true);
+        wrap((uint8_t*) mapped, s);
+    }
+    return hostResult("test_crash_codec");
+}
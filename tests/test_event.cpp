@@ -0,0 +1,37 @@
+// LogEvent::render: the text, logfmt and JSON lines of typed fields, JSON stays valid for any float
+#include "host.h"
+#include <math.h>
+#include "LogEvent.h"
+
+// defined with the sinks in LoggerDev.cpp, not linked here
+LogEvent::~LogEvent() {}
+
+static void same(const LogEvent& event, uint8_t format, const char* expected) {
+    char line[LOG_EVENT_SIZE * 2];
+    event.render(line, sizeof(line), format);
+    if (strcmp(line, expected)) {
+        printf("\"%s\" instead of \"%s\"\n", line, expected);
+        hostFailures++;
+    }
+}
+
+int main() {
+    LogEvent motor(NULL, 6, "motor");
+    motor.kv("rpm", 1200).kv("temp", 41.5).kv("ok", true).kv("name", "left wheel");
+    same(motor, LOG_FORMAT_TEXT, "motor rpm=1200 temp=41.5 ok=true name=left wheel\n");
+    same(motor, LOG_FORMAT_LOGFMT, "event=motor pri=6 rpm=1200 temp=41.5 ok=true name=\"left wheel\"\n");
+    same(motor, LOG_FORMAT_JSON, "{\"event\":\"motor\",\"pri\":6,\"rpm\":1200,\"temp\":41.5,\"ok\":true,\"name\":\"left wheel\"}\n");
+
+    // beyond the fixed point range of LogWriter::flt, and not a number
+    LogEvent big(NULL, 6, "big");
+    big.kv("x", 5e9).kv("y", -1.5e20).kv("z", 4294967000.0).kv("n", (double) NAN).kv("i", -(double) INFINITY);
+    same(big, LOG_FORMAT_JSON, "{\"event\":\"big\",\"pri\":6,\"x\":5e+09,\"y\":-1.5e+20,\"z\":4294967040.0,\"n\":null,\"i\":null}\n");
+    same(big, LOG_FORMAT_TEXT, "big x=5e+09 y=-1.5e+20 z=4294967040.0 n=nan i=-inf\n");
+
+    // stored as float: 7 significant digits
+    LogEvent precise(NULL, 6, "p");
+    precise.kv("v", 123456.789);
+    same(precise, LOG_FORMAT_TEXT, "p v=123456.789\n");
+
+    return hostResult("test_event");
+}
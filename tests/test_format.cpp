@@ -0,0 +1,102 @@
+// LogFmt::format: same text as snprintf for the conversions, flags, widths and precisions it takes
+#include "host.h"
+#include <math.h>
+#include "LogFormat.h"
+
+template<typename... A> static void same(const char* fmt, A... args) {
+    char   expected[128];
+    char   text[128];
+    LogArg list[] = { LogArg(), LogArg(args)... };
+
+    snprintf(expected, sizeof(expected), fmt, args...);
+    LogWriter w(text, sizeof(text));
+    LogFmt::format(w, fmt, list + 1, sizeof...(A));
+    if (strcmp(text, expected)) {
+        printf("\"%s\": \"%s\" instead of \"%s\"\n", fmt, text, expected);
+        hostFailures++;
+    }
+}
+
+int main() {
+    static const char* ints[]   = { "%d", "%i", "%5d", "%-5d|", "%05d", "%+d", "% d", "%+05d", "%.3d", "%8.3d", "%-+8.3d|",
+                                    "%.0d", "%u", "%x", "%X", "%#x", "%#X", "%#08x", "%o", "%#o", "%#.0o", "%.0x", "%c" };
+    static const int     ivals[]  = { 0, 1, -1, 7, 42, -42, 255, 65535, -100000, 2147483647, -2147483647 - 1 };
+    for (const char* f : ints) {
+        for (int v : ivals) {
+            if ((!strcmp(f, "%c")) && ((v < 32) || (v > 126))) continue;
+            same(f, v);
+        }
+    }
+    same("%lld %llu %llx", -1234567890123LL, 18446744073709551615ULL, 0x123456789abcdefULL);
+    same("%ld %lx %hu %zu", -5L, 0xdeadbeefUL, (unsigned short) 65535, (size_t) 12345);
+    same("%u %x", -1, -16);
+    same("%lu %lx", -1L, -16L);
+
+    static const char*   reals[] = { "%f", "%F", "%.0f", "%.1f", "%.2f", "%.3f", "%.9f", "%12.4f", "%-12.4f|", "%012.4f",
+                                     "%+f", "% f", "%+.0f", "%#.0f", "%+012.3f", "%.12f", "%e", "%E", "%.3e", "%+12.2e",
+                                     "%g", "%G", "%.3g", "%#g", "%-10g|", "%a", "%.2a" };
+    static const double  rvals[] = { 0.0, -0.0, 0.5, 1.5, 2.5, -2.5, 0.125, 0.375, 1.005, 2.675, 0.1, 1.0 / 3, -2.0 / 3,
+                                     3.14159265358979, 999999.9999995, 0.0000005, 0.0000015, 123456789.987654321,
+                                     4294967296.0, 1e15 + 0.5, 18446744073709549568.0, 18446744073709551616.0, 1e300, -1e-300,
+                                     INFINITY, -INFINITY, NAN, -NAN, 0.9999999999 };
+    for (const char* f : reals) {
+        for (double v : rvals) same(f, v);
+    }
+    for (double v = -20; v <= 20; v += 0.0625) {
+        same("%.0f %.1f %.2f %.3f", v, v, v, v);
+    }
+
+    same("%*d|%-*d|%*d", 6, 42, 6, 42, -6, 42);
+    same("%.*f|%*.*f", 2, 3.14159, 10, 3, 2.71828);
+    same("%s|%10s|%-10s|%.3s|%*.*s", "abc", "abc", "abc", "abcdef", 8, 2, "xyz");
+    same("%p", (void*) 0x3ffe1234);
+    same("100%% %d%%", 5);
+    same("%d %d", 1, 2.5 > 1 ? 3 : 4);
+    same("%f %d", 1.5f, 7);
+
+    // too few arguments: the conversion is copied as is
+    char      text[32];
+    LogArg    one[] = { LogArg(1) };
+    LogWriter w(text, sizeof(text));
+    LogFmt::format(w, "%d %05.2f", one, 1);
+    CHECK(!strcmp(text, "1 %05.2f"));
+
+    // checked at compile time: '*' takes an integer, %e and %g a float
+    static_assert(LogFmt::check("%*.*f %e %g %o", "iifffi"), "");
+    static_assert(!LogFmt::check("%*d", "fi"), "");
+    static_assert(!LogFmt::check("%n", "i"), "");
+    static_assert(!LogFmt::check("%e", "i"), "");
+
+    // LogHex, SSE2 on the host, against snprintf for every length and both separators
+    uint8_t bytes[40];
+    char    hex[160], expected[160];
+    for (size_t i = 0; i < sizeof(bytes); i++) bytes[i] = i * 37 + (i >> 2) * 0x80;
+    for (size_t len = 0; len <= sizeof(bytes); len++) {
+        size_t o = 0, e = 0;
+        expected[0] = '\0';
+        for (size_t i = 0; i < len; i++) o += snprintf(expected + o, 8, "%02x", bytes[i]);
+        *LogHex::bytes(hex, bytes, len) = '\0';
+        CHECK(!strcmp(hex, expected));
+        expected[0] = '\0';
+        for (size_t i = 0; i < len; i++) e += snprintf(expected + e, 8, "%02x ", bytes[i]);
+        *LogHex::bytes(hex, bytes, len, ' ') = '\0';
+        CHECK(!strcmp(hex, expected));
+    }
+    for (uint32_t v : { 0u, 0x3ffe8a20u, 0xdeadbeefu, 0xffffffffu, 0x0123abcdu }) {
+        snprintf(expected, sizeof(expected), "%08x", v);
+        *LogHex::word(hex, v) = '\0';
+        CHECK(!strcmp(hex, expected));
+    }
+    for (size_t len = 0; len <= LOG_HEX_LINE_BYTES; len += 4) {
+        size_t e = snprintf(expected, sizeof(expected), "%08x: ", 0x3ffe0010);
+        for (size_t i = 0; i < LOG_HEX_LINE_BYTES; i++) e += (i < len) ? snprintf(expected + e, 8, "%02x ", bytes[i]) : snprintf(expected + e, 8, "   ");
+        expected[e++] = ' ';
+        for (size_t i = 0; i < len; i++) expected[e++] = ((bytes[i] >= 0x20) && (bytes[i] < 0x7F)) ? bytes[i] : '.';
+        expected[e++] = '\n';
+        expected[e]   = '\0';
+        CHECK(LogHex::line(hex, 0x3ffe0010, bytes, len) == e);
+        CHECK(!strcmp(hex, expected));
+    }
+
+    return hostResult("test_format");
+}
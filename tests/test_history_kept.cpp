@@ -0,0 +1,79 @@
+// LogHistory with a kept history: warnings logged between floods of debug lines survive, and read back in order,
+// the debug lines dropped between them are counted as lost
+#include "host.h"
+#include "LogHistory.h"
+
+#define SIZE        4096        // Logger default history
+#define WARNINGS    20          // more than a kept block of them
+
+static bool check(size_t size, bool compress) {
+    static uint8_t memory[2 * SIZE];
+    size_t         kept = LogHistory::keptSize(size, 25, compress);
+    int            failures = hostFailures;
+
+    CHECK(kept >= LogHistory::minSize(false));
+    LogHistory main(memory, size - kept, compress);
+    LogHistory keptHistory(memory + size - kept, kept, false);
+    main.setKept(&keptHistory, 4);
+
+    // a warning every 50 debug lines, then a flood wiping out the main history many times
+    char     line[64];
+    uint32_t seq = 0, firstWarning = 0, lastWarning = 0;
+    for (int i = 0; i < WARNINGS * 50 + 5000; i++) {
+        seq++;
+        bool warning = (i % 50 == 0) && (i < WARNINGS * 50);
+        int  n = warning ? snprintf(line, sizeof(line), "Motor %d overheat, %d C\n", i / 50, 80 + i % 7)
+                         : snprintf(line, sizeof(line), "debug loop %d heap %d\n", i, 20000 + i % 1000);
+        main.add(seq, seq * 10, warning ? 4 : 7, line, n);
+        if ((warning) && (!firstWarning)) firstWarning = seq;
+        if (warning) lastWarning = seq;
+    }
+
+    // forEach: every warning, in sequence order, before the debug lines left
+    uint32_t previous = 0, warnings = 0;
+    main.forEach(0, [&](const tHistoryRecord& record, const char* text) -> bool {
+        CHECK((int32_t) (record.seq - previous) > 0);
+        previous = record.seq;
+        if (record.pri == 4) {
+            CHECK(strncmp(text, "Motor ", 6) == 0);
+            warnings++;
+        }
+        return true;
+    });
+    CHECK(warnings == WARNINGS);
+
+    // find
+    tHistoryQuery query;
+    uint32_t      found = 0;
+    LogHistory::parseQuery("overheat", query);
+    main.find(query, [&](const tHistoryRecord& record, const char*) -> bool { found += (record.pri == 4); return true; });
+    CHECK(found == WARNINGS);
+
+    // forRange over the time of the warnings
+    uint32_t inRange = 0;
+    main.forRange(firstWarning * 10, lastWarning * 10, [&](const tHistoryRecord& record, const char*) -> bool { inRange += (record.pri == 4); return true; });
+    CHECK(inRange == WARNINGS);
+
+    // lost: every record after since is either read back or counted, the first warning is followed by a gap
+    for (uint32_t since : { (uint32_t) 0, firstWarning, firstWarning + 1, lastWarning, seq - 100, seq }) {
+        uint32_t held = 0;
+        main.forEach(since, [&](const tHistoryRecord&, const char*) -> bool { held++; return true; });
+        CHECK(main.lost(since) + held == seq - since);
+    }
+    CHECK(main.lost(firstWarning) >= 49);
+    CHECK(main.lost(seq - 10) == 0);
+
+    if (hostFailures != failures) printf("  %u bytes, compress %d: %u warnings kept, %u found, %u in range\n", (unsigned) size, compress, (unsigned) warnings, (unsigned) found, (unsigned) inRange);
+    return hostFailures == failures;
+}
+
+int main() {
+    check(SIZE, false);
+    check(SIZE, true);              // the main part is too small to be compressed
+    check(2 * SIZE, true);
+
+    // too small for a kept history and a main one
+    CHECK(LogHistory::keptSize(2048, 25, true) == 0);
+    CHECK(LogHistory::keptSize(SIZE, 0, false) == 0);
+    return hostResult("test_history_kept");
+}
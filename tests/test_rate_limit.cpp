@@ -0,0 +1,72 @@
+// LogRateLimit: nothing limited by default, summaries of a call site once per interval and of a reused slot
+#include "host.h"
+#include "LogRateLimit.h"
+
+// call sites 4 * LOG_LIMIT_SITES bytes apart probe the same slots
+static char sites[LOG_LIMIT_WAYS + 2][4 * LOG_LIMIT_SITES];
+
+int main() {
+    LogRateLimit limiter;
+    uint16_t     suppressed;
+    uint8_t      pri;
+
+    // no limit until setLimit()
+    for (int i = 0; i < 1000; i++) CHECK(limiter.allow(sites[0], 7, 1000));
+    CHECK(!limiter.expired(1000, pri, suppressed));
+
+    // 10/s with a burst of 5: 5 pass, the next 15 are dropped
+    limiter.setLimit(6, 10, 5);
+    int passed = 0;
+    for (int i = 0; i < 20; i++) passed += limiter.allow(sites[0], 6, 2000);
+    CHECK(passed == 5);
+    CHECK(limiter.allow(sites[0], 6, 2100));                    // refilled, its summary still waits
+    CHECK(!limiter.expired(2100, pri, suppressed));
+    CHECK(!limiter.expired(2000 + LOG_LIMIT_SUMMARY - 1, pri, suppressed));
+    CHECK(limiter.expired(2000 + LOG_LIMIT_SUMMARY, pri, suppressed));
+    CHECK((pri == 6) && (suppressed == 15));
+    CHECK(!limiter.expired(2000 + LOG_LIMIT_SUMMARY, pri, suppressed));   // only once
+
+    // a sustained flood, handle() every 10 ms: one summary per interval, every message accounted for
+    LogRateLimit flood;
+    flood.setLimit(5, 10, 1);
+    uint32_t sent = 0, allowed = 0, reported = 0, summaries = 0;
+    for (uint32_t now = 10000; now < 10000 + 4 * LOG_LIMIT_SUMMARY; now++) {
+        for (int i = 0; i < 3; i++, sent++) allowed += flood.allow(sites[1], 5, now);
+        if (now % 10) continue;
+        while (flood.expired(now, pri, suppressed)) {
+            reported += suppressed;
+            summaries++;
+        }
+    }
+    while (flood.expired(10000 + 5 * LOG_LIMIT_SUMMARY, pri, suppressed)) reported += suppressed;
+    CHECK(summaries == 3);                                      // the fourth one is due at the end of the loop
+    CHECK(allowed + reported == sent);
+    CHECK((allowed >= 4 * LOG_LIMIT_SUMMARY / 100) && (allowed <= 4 * LOG_LIMIT_SUMMARY / 100 + 1));
+
+    // more than 1000 messages per second: the bucket refills by several messages per ms
+    LogRateLimit fast;
+    fast.setLimit(3, 2000, 100);
+    allowed = 0;
+    for (uint32_t now = 20000; now < 21000; now++) {
+        for (int i = 0; i < 5; i++) allowed += fast.allow(sites[2], 3, now);
+    }
+    CHECK((allowed >= 100 + 1998) && (allowed <= 100 + 2000));
+    CHECK(!fast.expired(20999, pri, suppressed));
+    CHECK(fast.expired(21000 + LOG_LIMIT_SUMMARY, pri, suppressed) && (suppressed == 5000 - allowed));
+
+    // one message dropped by each of more call sites than slots: none of the counts is lost
+    LogRateLimit crowded;
+    crowded.setLimit(4, 1, 1);
+    for (int s = 1; s < LOG_LIMIT_WAYS + 2; s++) {
+        CHECK(crowded.allow(sites[s], 4, 3000 + s));
+        CHECK(!crowded.allow(sites[s], 4, 3000 + s));
+    }
+    CHECK(crowded.expired(3010, pri, suppressed));              // the slot reused, reported at once
+    CHECK((pri == 4) && (suppressed == 1));
+    CHECK(!crowded.expired(3010, pri, suppressed));
+    uint32_t total = 0;
+    while (crowded.expired(3010 + LOG_LIMIT_SUMMARY, pri, suppressed)) total += suppressed;
+    CHECK(total == LOG_LIMIT_WAYS);
+
+    return hostResult("test_rate_limit");
+}
@@ -0,0 +1,84 @@
+// LogSerial on a slow UART: nothing waits outside LOG_SERIAL_BLOCK, drops are reported, truncation is marked, order is kept
+#include "host.h"
+#include "LogSerial.h"
+
+// UART whose FIFO only takes fifo bytes until the test lets it send them
+class SlowUart : public HardwareSerial {
+public:
+    std::string out;
+    int         fifo  = 0;
+    int         waits = 0;      // writes a real UART would have blocked on
+
+    size_t write(uint8_t c) override { return write(&c, 1); }
+    size_t write(const uint8_t* buffer, size_t size) override {
+        if ((int) size > fifo) waits++;
+        fifo = std::max(0, fifo - (int) size);
+        out.append((const char*) buffer, size);
+        return size;
+    }
+    int  availableForWrite() override { return fifo; }
+    void flush() override { fifo = 16; }
+};
+
+static void send(LogSerial& serial, SlowUart& uart, int rounds) {
+    for (int i = 0; i < rounds; i++) {
+        uart.fifo = 16;
+        serial.drain();
+    }
+}
+
+static void message(LogSerial& serial, const char* text, int i) {
+    char msg[40];
+    int  n = snprintf(msg, sizeof(msg), "%s %d\n", text, i);
+    serial.write("P ", 2, msg, n);
+}
+
+int main() {
+    static uint8_t ring[64];
+
+    // LOG_SERIAL_DROP: what fits goes out, the drop count comes before the next message
+    {
+        SlowUart  uart;
+        LogSerial serial(uart);
+        serial.begin(ring, sizeof(ring));
+        for (int i = 0; i < 10; i++) message(serial, "message", i);
+        CHECK(uart.out.empty());
+        CHECK(serial.getOverruns() == 5);
+        send(serial, uart, 10);
+        message(serial, "after", 0);
+        send(serial, uart, 10);
+        CHECK(uart.out == "P message 0\nP message 1\nP message 2\nP message 3\nP message 4\nSerial: 5 messages dropped\nP after 0\n");
+        CHECK(uart.waits == 0);
+    }
+
+    // LOG_SERIAL_TRUNCATE: the message that does not fit ends with "~\n"
+    {
+        SlowUart  uart;
+        LogSerial serial(uart);
+        serial.begin(ring, sizeof(ring));
+        serial.setPolicy(LOG_SERIAL_TRUNCATE);
+        for (int i = 0; i < 4; i++) message(serial, "truncated message", i);
+        send(serial, uart, 10);
+        CHECK(uart.out.compare(0, 44, "P truncated message 0\nP truncated message 1\n") == 0);
+        CHECK((uart.out.size() == 63) && (uart.out.compare(61, 2, "~\n") == 0));
+        CHECK(serial.getOverruns() == 2);
+        CHECK(uart.waits == 0);
+    }
+
+    // LOG_SERIAL_BLOCK: the ring goes out first, the writes wait for the UART, nothing is lost
+    {
+        SlowUart    uart;
+        LogSerial   serial(uart);
+        std::string expected;
+        serial.begin(ring, sizeof(ring));
+        for (int i = 0; i < 3; i++) message(serial, "ring", i);
+        serial.setPolicy(LOG_SERIAL_BLOCK);
+        for (int i = 0; i < 20; i++) message(serial, "block", i);
+        for (int i = 0; i < 3; i++)  expected += "P ring " + std::to_string(i) + "\n";
+        for (int i = 0; i < 20; i++) expected += "P block " + std::to_string(i) + "\n";
+        CHECK(uart.out == expected);
+        CHECK(serial.getOverruns() == 0);
+    }
+
+    return hostResult("test_serial");
+}
@@ -0,0 +1,211 @@
+#!/usr/bin/env python3
+"""
+Decoder of the binary Serial output of the Logger library (Log.setFormat(LOG_SINK_SERIAL, LOG_FORMAT_BINARY))
+
+  logdecode.py capture.bin                  decode a captured byte stream
+  logdecode.py /dev/ttyUSB0 --baud 115200   decode live from a serial port (needs pyserial)
+  logdecode.py capture.bin --stats          records per second against plain text at the same baud rate
+
+Records are COBS encoded and terminated by 0x00, see LogBinary.h for their layout.
+"""
+import argparse
+import re
+import struct
+import sys
+
+FORMAT, TEXT, PACKED, EVENT = 1, 2, 3, 4
+CONTINUED = 0x80    # priority flag of a text going on in the next frame
+KV_INT, KV_UINT, KV_FLOAT, KV_BOOL, KV_STR = 1, 2, 3, 4, 5
+PRIORITIES = ["EMERG", "ALERT", "CRIT", "ERR", "WARNING", "NOTICE", "INFO", "DEBUG"]
+SPEC = re.compile(r"%([-+ #0]*)(\d*)(\.\d+)?(hh|h|ll|l|z|j|t)?([diuxXocpsfFeEgGaA%])")
+
+
+def cobs_decode(data):
+    out = bytearray()
+    i = 0
+    while i < len(data):
+        code = data[i]
+        if code == 0 or i + code > len(data) + 1:
+            raise ValueError("bad COBS block")
+        out += data[i + 1:i + code]
+        i += code
+        if code < 0xFF and i < len(data):
+            out.append(0)
+    return bytes(out)
+
+
+def cstr(data, pos):
+    end = data.index(b"\0", pos)
+    return data[pos:end].decode("utf-8", "replace"), end + 1
+
+
+def unpack(fmt, data, pos):
+    """Rebuild the message from the format string and the packed arguments"""
+    out = []
+    last = 0
+    for m in SPEC.finditer(fmt):
+        out.append(fmt[last:m.start()])
+        last = m.end()
+        flags, width, prec, length, conv = m.groups()
+        if conv == "%":
+            out.append("%")
+            continue
+        spec = "%" + flags + width + (prec or "")
+        if conv == "s":
+            value, pos = cstr(data, pos)
+            out.append((spec + "s") % value)
+        elif conv in "fFeEgGaA":
+            (value,) = struct.unpack_from("<d", data, pos)
+            pos += 8
+            out.append((spec + ("f" if conv in "aA" else conv)) % value)
+        else:
+            size = 8 if length in ("ll", "j") else 4
+            signed = conv in "di"
+            (value,) = struct.unpack_from("<q" if size == 8 and signed else "<Q" if size == 8 else "<i" if signed else "<I", data, pos)
+            pos += size
+            if conv == "c":
+                out.append((spec + "c") % chr(value & 0xFF))
+            elif conv == "p":
+                out.append("0x%08x" % value)
+            else:
+                out.append((spec + ("d" if conv in "diu" else conv)) % value)
+    out.append(fmt[last:])
+    return "".join(out)
+
+
+def fields(data, pos):
+    out = []
+    while pos < len(data):
+        kind = data[pos]
+        key, pos = cstr(data, pos + 1)
+        if kind == KV_INT:
+            (value,) = struct.unpack_from("<i", data, pos)
+            pos += 4
+        elif kind == KV_UINT:
+            (value,) = struct.unpack_from("<I", data, pos)
+            pos += 4
+        elif kind == KV_FLOAT:
+            (value,) = struct.unpack_from("<f", data, pos)
+            value = "%g" % value
+            pos += 4
+        elif kind == KV_BOOL:
+            value = "true" if data[pos] else "false"
+            pos += 1
+        else:
+            n = data[pos]
+            value = data[pos + 1:pos + 1 + n].decode("utf-8", "replace")
+            pos += 1 + n
+        out.append("%s=%s" % (key, value))
+    return " ".join(out)
+
+
+class Decoder:
+    def __init__(self):
+        self.formats = {}
+        self.partial = None     # header and bytes of a text continued in the next frame
+        self.seq = None
+        self.records = 0
+        self.lost = 0
+        self.errors = 0
+        self.binary = 0     # bytes received
+        self.text = 0       # bytes the same records take as text lines with the time prefix
+
+    def record(self, frame):
+        kind = frame[0]
+        if kind == FORMAT:
+            self.formats[frame[1]], _ = cstr(frame, 2)
+            return ""
+
+        seq, pri, ms = struct.unpack_from("<HBI", frame, 1)
+        out = ""
+        if self.partial and (kind != TEXT or seq != self.partial[0]):
+            # the rest of the text was dropped, marked as the text sink marks a truncated message
+            out += self.line(*self.partial[:3], self.partial[3].decode("utf-8", "replace") + "~\n")
+            self.partial = None
+        if kind == TEXT:
+            text = (self.partial[3] if self.partial else b"") + frame[8:]
+            if pri & CONTINUED:
+                self.partial = (seq, pri & 7, ms, text)
+                return out
+            self.partial = None
+            msg = text.decode("utf-8", "replace")
+        elif kind == PACKED:
+            fmt = self.formats.get(frame[8])
+            msg = unpack(fmt, frame, 9) if fmt is not None else "<format %d not received yet>\n" % frame[8]
+        elif kind == EVENT:
+            name, pos = cstr(frame, 8)
+            msg = (name + " " + fields(frame, pos)).rstrip() + "\n"
+        else:
+            raise ValueError("unknown record type %d" % kind)
+        return out + self.line(seq, pri, ms, msg)
+
+    def line(self, seq, pri, ms, msg):
+        # records dropped by the device show as a gap in the sequence numbers
+        out = ""
+        if self.seq is not None and seq != (self.seq + 1) & 0xFFFF:
+            lost = (seq - self.seq - 1) & 0xFFFF
+            self.lost += lost
+            out = "<%d records lost>\n" % lost
+        self.seq = seq
+        self.records += 1
+
+        line = "%02d:%02d:%02d.%03d %-7s %s" % (ms // 3600000 % 100, ms // 60000 % 60, ms // 1000 % 60, ms % 1000, PRIORITIES[pri & 7], msg)
+        if not line.endswith("\n"):
+            line += "\n"
+        self.text += len("HH:MM:SS.mmm - ") + len(msg.rstrip("\n")) + 1
+        return out + line
+
+    def feed(self, chunk, out):
+        self.binary += len(chunk)
+        self.pending = getattr(self, "pending", b"") + chunk
+        *frames, self.pending = self.pending.split(b"\0")
+        for frame in frames:
+            if not frame:
+                continue
+            try:
+                line = self.record(cobs_decode(frame))
+            except (ValueError, IndexError, struct.error, TypeError) as e:
+                self.errors += 1
+                out.write("<bad record: %s>\n" % e)
+                continue
+            if line:
+                out.write(line)
+
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__, formatter_class=argparse.RawDescriptionHelpFormatter)
+    parser.add_argument("input", help="captured file, '-' for stdin, or serial port")
+    parser.add_argument("--baud", type=int, default=115200)
+    parser.add_argument("--stats", action="store_true", help="print records per second against text at --baud")
+    args = parser.parse_args()
+
+    decoder = Decoder()
+    if args.input == "-":
+        source = sys.stdin.buffer
+    elif args.input.startswith("/dev/"):
+        import serial
+        source = serial.Serial(args.input, args.baud, timeout=0.1)
+    else:
+        source = open(args.input, "rb")
+
+    try:
+        while True:
+            chunk = source.read(4096)
+            if not chunk:
+                if args.input.startswith("/dev/"):
+                    continue
+                break
+            decoder.feed(chunk, sys.stdout)
+            sys.stdout.flush()
+    except KeyboardInterrupt:
+        pass
+
+    if args.stats and decoder.records:
+        byte_rate = args.baud / 10.0    # 8N1
+        print("records %d, lost %d, bad %d" % (decoder.records, decoder.lost, decoder.errors), file=sys.stderr)
+        print("binary: %.1f bytes/record, %.0f records/s" % (decoder.binary / decoder.records, byte_rate * decoder.records / decoder.binary), file=sys.stderr)
+        print("text  : %.1f bytes/record, %.0f records/s" % (decoder.text / decoder.records, byte_rate * decoder.records / decoder.text), file=sys.stderr)
+
+
+if __name__ == "__main__":
+    main()
@@ -0,0 +1,133 @@
+#!/usr/bin/env python3
+"""
+Scripted WebSocket feeder for the WebSerial page, to measure its rendering throughput without a device
+
+  webfeed.py --lines 100000 --rate 5000 --exit &
+  chromium --headless=new --disable-gpu http://localhost:8080/
+
+Serves the page of WebSerialSM_webpage.h on http://localhost:<port>/ and feeds /webserialws with
+"<prio>HH:MM:SS.mmm - message" lines in frames of at most 256 bytes, as WebSerialSM does.
+When all lines are sent it asks the page for its counters (window.viewerStats) and prints them.
+No dependency but the Python standard library.
+"""
+import argparse
+import asyncio
+import base64
+import gzip
+import hashlib
+import os
+import random
+import re
+import struct
+import time
+
+CHUNK = 256
+HERE = os.path.dirname(os.path.abspath(__file__))
+MESSAGES = [
+    "WiFi connected, rssi %d dBm",
+    "MQTT publish home/sensor/%d",
+    "Heap free %d bytes",
+    "Relay %d switched",
+    "HTTP GET /api/status 200 in %d ms",
+]
+
+
+def load_page(header):
+    text = open(header).read()
+    array = re.search(r"WEBSERIAL_HTML\[\] PROGMEM = \{(.*?)\};", text, re.S).group(1)
+    return gzip.decompress(bytes(int(x, 16) for x in re.findall(r"0x([0-9A-Fa-f]{2})", array)))
+
+
+def frame(payload):
+    data = payload.encode()
+    if len(data) < 126:
+        head = struct.pack("!BB", 0x81, len(data))
+    elif len(data) < 65536:
+        head = struct.pack("!BBH", 0x81, 126, len(data))
+    else:
+        head = struct.pack("!BBQ", 0x81, 127, len(data))
+    return head + data
+
+
+async def read_frame(reader):
+    b0, b1 = await reader.readexactly(2)
+    n = b1 & 0x7F
+    if n == 126:
+        (n,) = struct.unpack("!H", await reader.readexactly(2))
+    elif n == 127:
+        (n,) = struct.unpack("!Q", await reader.readexactly(8))
+    mask = await reader.readexactly(4) if b1 & 0x80 else b"\0\0\0\0"
+    data = bytes(c ^ mask[i % 4] for i, c in enumerate(await reader.readexactly(n)))
+    return b0 & 0x0F, data.decode(errors="replace")
+
+
+async def feed(writer, args):
+    start = time.time()
+    chunk = ""
+    for i in range(args.lines):
+        ms = int((time.time() - start) * 1000)
+        line = "<%d>%02d:%02d:%02d.%03d - %s\n" % (random.randint(3, 7), ms // 3600000 % 24, ms // 60000 % 60,
+                                                  ms // 1000 % 60, ms % 1000, random.choice(MESSAGES) % i)
+        if len(chunk) + len(line) > CHUNK:
+            writer.write(frame(chunk))
+            chunk = ""
+        chunk += line
+        if args.rate and i % 100 == 99:
+            await writer.drain()
+            await asyncio.sleep(max(0, start + (i + 1) / args.rate - time.time()))
+    if chunk:
+        writer.write(frame(chunk))
+    writer.write(frame("#Stats"))
+    await writer.drain()
+    print("sent %d lines in %.2f s" % (args.lines, time.time() - start), flush=True)
+
+
+async def handle(reader, writer, args, page, done):
+    request = (await reader.readuntil(b"\r\n\r\n")).decode()
+    path = request.split(" ")[1]
+    key = re.search(r"Sec-WebSocket-Key: (.*)\r\n", request, re.I)
+
+    if path != "/webserialws" or not key:
+        writer.write(b"HTTP/1.1 200 OK\r\nContent-Type: text/html\r\nContent-Length: %d\r\nConnection: close\r\n\r\n" % len(page) + page)
+        await writer.drain()
+        writer.close()
+        return
+
+    accept = base64.b64encode(hashlib.sha1((key.group(1).strip() + "258EAFA5-E914-47DA-95CA-C5AB0DC85B11").encode()).digest())
+    writer.write(b"HTTP/1.1 101 Switching Protocols\r\nUpgrade: websocket\r\nConnection: Upgrade\r\nSec-WebSocket-Accept: " + accept + b"\r\n\r\n")
+    asyncio.ensure_future(feed(writer, args))
+
+    try:
+        while True:
+            opcode, data = await read_frame(reader)
+            if opcode == 8:
+                break
+            if data.startswith("#Stats# "):
+                print("page: " + data[8:], flush=True)
+                if args.exit:
+                    done.set()
+                    break
+    except (asyncio.IncompleteReadError, ConnectionError):
+        pass
+    writer.close()
+
+
+async def main():
+    parser = argparse.ArgumentParser(description=__doc__, formatter_class=argparse.RawDescriptionHelpFormatter)
+    parser.add_argument("--port", type=int, default=8080)
+    parser.add_argument("--lines", type=int, default=100000)
+    parser.add_argument("--rate", type=int, default=0, help="lines per second, 0 = as fast as possible")
+    parser.add_argument("--exit", action="store_true", help="stop once the page reported its counters")
+    parser.add_argument("--page", default=os.path.join(HERE, "..", "WebSerialSM_webpage.h"))
+    args = parser.parse_args()
+
+    page = load_page(args.page)
+    done = asyncio.Event()
+    server = await asyncio.start_server(lambda r, w: handle(r, w, args, page, done), "0.0.0.0", args.port)
+    print("serving on http://localhost:%d/" % args.port, flush=True)
+    async with server:
+        await done.wait()
+
+
+if __name__ == "__main__":
+    asyncio.run(main())